@@ -0,0 +1,21 @@
+#ifndef ENGINE_CONFIG_H
+#define ENGINE_CONFIG_H
+
+#include <cstddef>
+
+// Capacités réservées à la construction d'un MatchingEngine.
+// Tant qu'elles ne sont pas dépassées, le carnet (noeuds des ordres, niveaux de prix, index des ID)
+// ne fait aucune allocation : la mémoire est prise une fois pour toutes au démarrage.
+// Au-delà, les réserves grandissent (par doublement), sans erreur.
+struct EngineConfig {
+    size_t order_capacity;      // nombre d'ordres au repos simultanés prévu
+    size_t level_capacity;      // nombre de niveaux de prix prévu (les deux côtés du carnet)
+    size_t result_capacity;     // nombre de résultats prévu (historique de l'engine)
+    bool keep_history;          // false : les résultats ne sont que transmis à l'abonné, pas conservés
+    bool track_depth;           // true : variations des niveaux de prix (L2) enregistrées à chaque ordre
+
+    EngineConfig()
+        : order_capacity(1024), level_capacity(256), result_capacity(0), keep_history(true), track_depth(false) {}
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef ENGINE_LISTENER_H
+#define ENGINE_LISTENER_H
+
+#include <vector>
+#include "core/OrderBook.h"
+#include "core/ResultTable.h"
+
+// Abonnés aux événements du matching engine.
+// L'engine appelle l'abonné de façon synchrone, dans processOrder : une fois l'ordre entrant traité,
+// chaque résultat qu'il a produit est transmis dans l'ordre de l'historique (ordre entrant puis ordres
+// du carnet impactés). Chaque résultat correspond à un seul événement :
+//  - onAccepted        : NEW placé au carnet (PENDING)
+//  - onModified        : MODIFY appliqué, l'ordre reste au carnet (PENDING)
+//  - onFilled          : exécution qui solde l'ordre (EXECUTED)
+//  - onPartiallyFilled : exécution partielle (PARTIALLY_EXECUTED)
+//  - onCanceled        : CANCEL appliqué (CANCELED)
+//  - onRejected        : ordre refusé (REJECTED)
+// Par défaut, chaque événement est renvoyé vers onResult : un abonné qui traite tous les résultats
+// de la même façon (ex : écriture d'un fichier) ne redéfinit que onResult.
+// Si l'engine suit la profondeur (EngineConfig::track_depth), onDepthUpdate reçoit ensuite les variations
+// des niveaux de prix modifiés par l'ordre (flux L2 incrémental), quand il y en a.
+
+// Variante à l'exécution : l'abonné est enregistré sur l'engine (setListener), appel virtuel par événement
+class EngineListener {
+public:
+    virtual ~EngineListener() = default;
+
+    virtual void onResult(const OrderResult&) {}
+
+    virtual void onAccepted(const OrderResult& result) { onResult(result); }
+    virtual void onModified(const OrderResult& result) { onResult(result); }
+    virtual void onFilled(const OrderResult& result) { onResult(result); }
+    virtual void onPartiallyFilled(const OrderResult& result) { onResult(result); }
+    virtual void onCanceled(const OrderResult& result) { onResult(result); }
+    virtual void onRejected(const OrderResult& result) { onResult(result); }
+
+    virtual void onDepthUpdate(const std::vector<LevelDelta>&) {}
+};
+
+// Variante à la compilation : l'abonné est passé en paramètre template (processOrder(order, listener)),
+// les appels sont résolus (et inlinés) à la compilation. N'importe quel type qui fournit les six méthodes
+// et onDepthUpdate convient ; en héritant de StaticListener<Abonné>, on ne redéfinit que celles dont on a besoin
+// (les autres renvoient vers onResult de l'abonné, qui par défaut ne fait rien).
+template <typename Derived>
+class StaticListener {
+public:
+    void onResult(const OrderResult&) {}
+
+    void onAccepted(const OrderResult& result) { self().onResult(result); }
+    void onModified(const OrderResult& result) { self().onResult(result); }
+    void onFilled(const OrderResult& result) { self().onResult(result); }
+    void onPartiallyFilled(const OrderResult& result) { self().onResult(result); }
+    void onCanceled(const OrderResult& result) { self().onResult(result); }
+    void onRejected(const OrderResult& result) { self().onResult(result); }
+
+    void onDepthUpdate(const std::vector<LevelDelta>&) {}
+
+private:
+    Derived& self() { return static_cast<Derived&>(*this); }
+};
+
+// Transmission d'un résultat à un abonné (virtuel ou non), selon son statut
+template <typename Listener>
+inline void dispatchEvent(Listener& listener, const OrderResult& result) {
+    switch (result.status) {
+        case OrderStatus::PENDING:
+            if (result.original_order.action == Action::MODIFY) {
+                listener.onModified(result);
+            } else {
+                listener.onAccepted(result);
+            }
+            break;
+        case OrderStatus::EXECUTED:
+            listener.onFilled(result);
+            break;
+        case OrderStatus::PARTIALLY_EXECUTED:
+            listener.onPartiallyFilled(result);
+            break;
+        case OrderStatus::CANCELED:
+            listener.onCanceled(result);
+            break;
+        case OrderStatus::REJECTED:
+            listener.onRejected(result);
+            break;
+    }
+}
+
+// Abonné qui recopie les résultats dans une ResultTable (ex : collecte dans les tests, ou historique
+// d'un engine configuré sans historique). Utilisable avec les deux variantes (final : les appels de la
+// variante template ne passent pas par la table virtuelle).
+class ResultCollector final : public EngineListener {
+public:
+    void onResult(const OrderResult& result) override { results.append(result); }
+
+    ResultTable results;
+};
+
+#endif
@@ -2,135 +2,195 @@
 #define MATCHING_ENGINE_H
 
 #include <vector>
-#include <queue>
-#include <map>
 #include <iostream>
 #include "data/CSVReader.h"  // Pour accéder à la structure Order
+#include "core/EngineConfig.h"
+#include "core/OrderBook.h"
+#include "core/OrderIndex.h"
+#include "core/EngineListener.h"
+#include "core/ResultTable.h"
 
 // Structure pour représenter une transaction exécutée (on a besoin du timestamp correspondant au moment du trade,
-// des ID des ordres d'achat et de vente qui se rencontrent, du nom de l'action (AAPL,...), de la quantité échangée et du prix)
+// des ID des ordres d'achat et de vente qui se rencontrent, de la quantité échangée et du prix).
+// L'instrument n'est pas recopié : c'est toujours celui de l'ordre entrant (un engine = un instrument).
+// La structure ne contient aucune chaîne, elle peut donc être stockée dans un buffer réutilisé sans allocation.
 struct Trade {
     long long timestamp;
     int buy_order_id;
     int sell_order_id;
-    std::string instrument;
     int quantity;
-    float price;
+    Price price;
     
     // Constructeur
-    Trade(long long ts, int buy_id, int sell_id, const std::string& inst, int qty, float p)
+    Trade(long long ts, int buy_id, int sell_id, int qty, Price p)
         : timestamp(ts), buy_order_id(buy_id), sell_order_id(sell_id), 
-          instrument(inst), quantity(qty), price(p) {}
+          quantity(qty), price(p) {}
 };
 
-// Structure pour les ordres avec état (pour l'output final, on veut présenter en plus des caractéristiques de l'ordre
-// la quantité exécutée, l'ID de la contrepartie si besoin, le prix d'exécution et naturellement le statut.)
-struct OrderResult {
-    Order original_order;
-    std::string status;           // EXECUTED, PARTIALLY_EXECUTED, PENDING, CANCELED, REJECTED
-    int executed_quantity;
-    float execution_price;
-    int counterparty_id;
-    
-    // Constructeur
-    OrderResult(const Order& order) 
-        : original_order(order), status("PENDING"), executed_quantity(0), 
-          execution_price(0.0f), counterparty_id(0) {}
-};
-
-// Comparateur pour les ordres d'achat (prix décroissant, puis FIFO)
-// Logique : Meilleurs acheteurs (prix plus élevés) en tête de queue
-// En cas d'égalité de prix : ordre chronologique (FIFO)
-// Nécessaire pour les objets priority_queue
-struct BuyComparator {
-    bool operator()(const Order& a, const Order& b) const {
-        if (a.price != b.price) {
-            return a.price < b.price;  // Prix décroissant (plus haut prix en tête)
-        }
-        return a.timestamp > b.timestamp;  // Si même prix, plus ancien en tête (timestamp plus petit = plus ancien)
-    }
-};
-
-// Comparateur pour les ordres de vente (prix croissant, puis FIFO)
-// Logique : Meilleurs vendeurs (prix plus faibles) en tête de queue
-// En cas d'égalité de prix : ordre chronologique (FIFO)
-// Nécessaire pour les objets priority_queue
-struct SellComparator {
-    bool operator()(const Order& a, const Order& b) const {
-        if (a.price != b.price) {
-            return a.price > b.price;  // Prix croissant (plus bas prix en tête)
-        }
-        return a.timestamp > b.timestamp;  // Si même prix, plus ancien en tête (timestamp plus petit = plus ancien)
-    }
-};
+// Capacité initiale des buffers de matching (trades et ordres impactés d'un ordre entrant)
+constexpr size_t MATCH_BUFFER_CAPACITY = 64;
 
 class MatchingEngine {
 private:
-    // Carnets d'ordres (priority queues)
-    // Les objets priority_queue permettent d'ordonner automatiquement les données contenues
-    // selon une règle spécifique (la comparaison ici, pour avoir le prix le plus haut dans le book d'achat en premier par exemple)
-    std::priority_queue<Order, std::vector<Order>, BuyComparator> buy_book;
-    std::priority_queue<Order, std::vector<Order>, SellComparator> sell_book;
-    
-    // Ordres impactés temporaires (pour l'ordre d'affichage)
+    // Carnet d'ordres (BUY et SELL) organisé par niveaux de prix, chaque niveau étant une file FIFO
+    // Le meilleur prix est en tête de chaque côté, et un ordre peut être retiré directement via son handle
+    OrderBook book;
+    
+    // Buffers de l'ordre en cours de matching : trades générés et résultats des ordres du carnet impactés
+    // (pour l'ordre d'affichage). Ils sont vidés à chaque ordre mais gardent leur capacité :
+    // pas d'allocation par ordre une fois la taille maximale atteinte.
+    std::vector<Trade> trade_buffer;
     std::vector<OrderResult> pending_impacted_orders;
     
-    // Map pour retrouver rapidement les ordres par ID (pour MODIFY/CANCEL, car on ne peut pas retirer une ligne directement d'un priority_queue)
-    std::map<int, Order> order_map;
+    // Index pour retrouver rapidement les ordres au repos par ID (pour MODIFY/CANCEL et le contrôle des doublons) :
+    // ID -> handle dans le carnet. L'ordre lui-même n'est stocké qu'une fois, dans le carnet.
+    OrderIndex order_index;
     
     // Timestamp actuel pour les modifications
     long long current_timestamp;
 
-    // Historique des trades
-    std::vector<OrderResult> historic_trades;
+    // Historique des trades, en colonnes (voir ResultTable). Sans historique (EngineConfig::keep_history),
+    // il ne contient que les résultats de l'ordre en cours, le temps de les transmettre à l'abonné.
+    ResultTable historic_trades;
+
+    // Table où matchOrder écrit les résultats : l'historique, sauf pendant processOrders (table de l'appelant)
+    ResultTable* output;
+
+    // Abonné aux événements (variante virtuelle, nullptr si aucun)
+    EngineListener* listener;
+    bool keep_history;
 
 public:
 
-    // Getter pour l'Historique des trades (output final)
-    std::vector<OrderResult> getTradeHistoric(){return historic_trades;}
+    // Getter pour l'Historique des trades (output final) : vue sur l'historique, sans copie
+    ResultView getTradeHistoric() const { return historic_trades.view(); }
 
-    // Constructeur
+    // Constructeur (capacités par défaut, ou réservées selon la configuration)
     MatchingEngine();
+    explicit MatchingEngine(const EngineConfig& config);
     
     // Destructeur
     ~MatchingEngine();
     
     // VOIR MatchingEngine.cpp POUR PLUS D'EXPLICATIONS SUR LES METHODES !! 
 
-    // Méthode principale pour boucler sur tous les ordres
-    std::vector<OrderResult> processAllOrders(const std::vector<Order>& orders);
+    // Méthode principale pour boucler sur tous les ordres (vecteur ou vue sans copie, ex : les ordres d'un actif)
+    // Renvoie une vue sur l'historique complet de l'engine (valide tant que l'engine n'est pas vidé)
+    ResultView processAllOrders(const std::vector<Order>& orders);
+    ResultView processAllOrders(const OrderView& orders);
     
-    // Méthode pour traiter un ordre individuel
+    // Méthode pour traiter un ordre individuel, dans l'ordre d'arrivée (sans tri).
+    // Les résultats de l'ordre sont transmis à l'abonné enregistré par setListener, s'il y en a un.
     void processOrder(const Order& order);
+
+    // Variantes template : les résultats sont transmis à listener (appels résolus à la compilation)
+    // au lieu de l'abonné enregistré (voir EngineListener.h)
+    template <typename Listener>
+    void processOrder(const Order& order, Listener& listener);
+    template <typename Listener>
+    ResultView processAllOrders(const OrderView& orders, Listener& listener);
+
+    // Entrée sans copie ni tri, pour le régime établi : les ordres (vue ou span sur un tableau de l'appelant,
+    // déjà dans l'ordre chronologique) sont traités un à un et leurs résultats écrits directement dans la table
+    // de l'appelant (recopiés dans l'historique seulement avec EngineConfig::keep_history, en général désactivé).
+    // Aucune allocation une fois les capacités de l'engine et de out atteintes. Renvoie le nombre de résultats.
+    size_t processOrders(const OrderView& orders, ResultTable& out);
+
+    // Abonné (variante virtuelle) appelé pour chaque résultat, dans processOrder (nullptr : aucun).
+    // L'engine ne possède pas l'abonné, qui doit rester en vie tant qu'il est enregistré.
+    void setListener(EngineListener* listener);
     
     // Gestion des actions
     void handleNew(const Order& order);
+    void handleNew(const Order& order, OrderState state);
     void handleModify(const Order& order);
     void handleCancel(const Order& order);
     
-    // Algorithme de matching
-    std::vector<Trade> tryMatch(Order& incoming_order);
+    // Algorithme de matching (les trades renvoyés restent valides jusqu'au prochain appel)
+    const std::vector<Trade>& tryMatch(const Order& incoming_order);
     
-    // Ajout d'un ordre au carnet approprié
+    // Ajout d'un ordre au carnet approprié (avec son état de suivi, par défaut celui d'un ordre nouveau)
     void addToBook(const Order& order);
+    void addToBook(const Order& order, const OrderState& state);
     
     // Recherche et suppression d'un ordre du carnet
-    bool removeFromBook(int order_id, const std::string& side);
+    bool removeFromBook(int order_id);
     
-    // Affichage des carnets (debug)
+    // Affichage des carnets (debug) : taille et meilleurs niveaux de chaque côté
     void displayBooks() const;
+
+    // Meilleur achat / meilleure vente (prix, quantité agrégée, nombre d'ordres), en O(1)
+    TopOfBook topOfBook() const { return book.topOfBook(); }
+
+    // Les max_levels meilleurs niveaux d'un côté (profondeur L2), écrits dans out, en O(max_levels)
+    size_t depth(Side side, size_t max_levels, DepthLevel* out) const { return book.depth(side, max_levels, out); }
+
+    // Variations des niveaux de prix causées par le dernier ordre traité (vide si EngineConfig::track_depth
+    // n'est pas activé) : une entrée par niveau modifié, avec son nouvel agrégat
+    const std::vector<LevelDelta>& lastDepthChanges() const { return book.levelDeltas(); }
     
     // Récupération des résultats
-    const std::vector<OrderResult>& getResults() const;
+    const ResultTable& getResults() const;
+
+    // Transfert des résultats accumulés à la fin de out, ligne par ligne (l'historique de l'engine est ensuite
+    // vide, mais garde ses blocs)
+    void drainResults(std::vector<OrderResult>& out);
+
+    // Transfert des résultats accumulés à la fin d'une table : si out est vide, les deux tables sont échangées
+    // (aucune copie : l'engine récupère les blocs de out pour la suite)
+    void drainResults(ResultTable& out);
     
     // Affichage des résultats
     void displayResults() const;
     
 private:
+    // Traitement d'un ordre (résultats ajoutés à la table output, sans transmission)
+    void matchOrder(const Order& order);
+
+    // Transmission à l'abonné enregistré des résultats ajoutés depuis la position first (ou vidage de
+    // l'historique s'il n'est pas conservé)
+    void finishOrder(size_t first);
+
+    // Transmission à listener des résultats de table ajoutés depuis la position first
+    template <typename Listener>
+    void publish(const ResultTable& table, size_t first, Listener& listener);
+
+    // Contrôle du tri par timestamp : renvoie true si les ordres sont déjà triés, sinon remplit
+    // sorted_positions avec les positions des ordres dans l'ordre chronologique
+    bool chronologicalOrder(const OrderView& orders, std::vector<uint32_t>& sorted_positions) const;
+
     // Méthodes utilitaires
     long long getCurrentTimestamp();
-    OrderResult createResult(const Order& order, const std::string& status, 
-                           int exec_qty = 0, float exec_price = 0.0f, int counterparty = 0);
 };
 
+template <typename Listener>
+void MatchingEngine::publish(const ResultTable& table, size_t first, Listener& target) {
+    for (size_t i = first; i < table.size(); i++) {
+        dispatchEvent(target, table[i]);
+    }
+    if (!book.levelDeltas().empty()) {
+        target.onDepthUpdate(book.levelDeltas());
+    }
+}
+
+template <typename Listener>
+void MatchingEngine::processOrder(const Order& order, Listener& target) {
+    size_t first = historic_trades.size();
+    matchOrder(order);
+    publish(historic_trades, first, target);
+    if (!keep_history) {
+        historic_trades.clear();
+    }
+}
+
+template <typename Listener>
+ResultView MatchingEngine::processAllOrders(const OrderView& orders, Listener& target) {
+    std::vector<uint32_t> sorted_positions;
+    bool is_sorted = chronologicalOrder(orders, sorted_positions);
+    for (size_t i = 0; i < orders.size(); i++) {
+        processOrder(is_sorted ? orders[i] : orders[sorted_positions[i]], target);
+    }
+    return historic_trades.view();
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,170 @@
+#ifndef ORDER_BOOK_H
+#define ORDER_BOOK_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "data/CSVReader.h"  // Pour accéder à la structure Order
+#include "utils/PoolAllocator.h"
+
+// Identifiant d'un ordre au repos dans le carnet (indice dans le stockage des noeuds).
+// Il reste valide tant que l'ordre n'est pas retiré du carnet.
+using OrderHandle = uint32_t;
+constexpr OrderHandle NULL_HANDLE = UINT32_MAX;
+
+// Niveau de prix : file FIFO (intrusive, chaînée par les handles) des ordres au repos à ce prix,
+// avec la quantité agrégée et le nombre d'ordres (mis à jour à chaque ajout / retrait / exécution)
+struct PriceLevel {
+    Price price;
+    OrderHandle head;         // Ordre le plus ancien (premier servi)
+    OrderHandle tail;         // Ordre le plus récent
+    long long total_quantity;
+    uint32_t order_count;
+    uint32_t delta_slot;      // position de la variation de ce niveau dans les variations de l'ordre en cours
+    uint64_t delta_epoch;     // ordre (numéro de série) pour lequel delta_slot est valide
+};
+
+// Agrégat d'un niveau de prix, vu de l'extérieur (profondeur L2)
+struct DepthLevel {
+    Price price;
+    long long quantity;
+    uint32_t order_count;
+};
+
+// Meilleur niveau de chaque côté (BBO), has_bid / has_ask à false si le côté est vide
+struct TopOfBook {
+    DepthLevel bid;
+    DepthLevel ask;
+    bool has_bid;
+    bool has_ask;
+};
+
+// Variation d'un niveau de prix : nouvel agrégat du niveau après l'ordre traité.
+// quantity == 0 et order_count == 0 : le niveau a disparu. Appliquées dans l'ordre, les variations d'un ordre
+// donnent l'état exact du carnet (un niveau supprimé puis recréé par le même ordre apparaît deux fois).
+struct LevelDelta {
+    Side side;
+    Price price;
+    long long quantity;
+    uint32_t order_count;
+};
+
+// Un côté du carnet : niveaux de prix triés du meilleur au moins bon.
+// Pour avoir un seul type de map pour les deux côtés, la clé est le prix "orienté" :
+// -prix pour le côté BUY (le prix le plus haut est en tête), +prix pour le côté SELL.
+// Le meilleur niveau est donc toujours begin().
+// Les noeuds de la map sont pris dans une réserve de blocs (SlabPool) du carnet : créer ou supprimer un niveau
+// ne fait pas d'allocation en régime établi.
+using LevelMap = std::map<Price, PriceLevel, std::less<Price>, PoolAllocator<std::pair<const Price, PriceLevel>>>;
+
+// État de suivi d'un ordre au repos, conservé avec lui dans le carnet (évite de relire l'historique) :
+// quantité de l'ordre NEW d'origine (conservée à travers les MODIFY), quantité cumulée exécutée, dernier statut
+struct OrderState {
+    int original_quantity;
+    int filled_quantity;
+    OrderStatus last_status;
+};
+
+// Noeud de stockage d'un ordre au repos : l'ordre lui-même, ses voisins dans la file du niveau
+// et un itérateur vers son niveau (les itérateurs de map restent valides tant que le niveau existe).
+// Un noeud libre est chaîné aux autres noeuds libres par next.
+struct BookNode {
+    Order order;
+    OrderState state;
+    OrderHandle prev;
+    OrderHandle next;
+    LevelMap::iterator level;
+    bool is_buy;
+};
+
+// Carnet d'ordres par niveaux de prix.
+// - ajout en fin de file du niveau : O(log L) (L = nombre de niveaux de prix)
+// - retrait d'un ordre quelconque via son handle : O(1) (+ suppression du niveau s'il devient vide)
+// - accès au meilleur ordre : O(1)
+// Les noeuds des ordres et des niveaux sont réservés à la construction (capacités prévues) puis recyclés :
+// en régime établi, ajouts, retraits et exécutions ne font aucun malloc / free.
+class OrderBook {
+public:
+    OrderBook(size_t order_capacity = 1024, size_t level_capacity = 256);
+
+    // Les niveaux et les noeuds se référencent entre eux : le carnet ne se copie pas
+    OrderBook(const OrderBook&) = delete;
+    OrderBook& operator=(const OrderBook&) = delete;
+
+    // Ajout d'un ordre LIMIT en fin de file de son niveau de prix (avec son état de suivi), renvoie son handle
+    OrderHandle add(const Order& order, const OrderState& state);
+
+    // Retrait d'un ordre du carnet (annulation, modification ou exécution totale)
+    void remove(OrderHandle handle);
+
+    // Exécution (partielle ou totale) d'un ordre au repos : réduction de sa quantité sans perte de priorité,
+    // et mise à jour de son état de suivi
+    void reduce(OrderHandle handle, int quantity);
+
+    // Accès à l'ordre stocké derrière un handle
+    Order& get(OrderHandle handle) { return nodes[handle].order; }
+    const Order& get(OrderHandle handle) const { return nodes[handle].order; }
+
+    // Accès à l'état de suivi d'un ordre
+    const OrderState& state(OrderHandle handle) const { return nodes[handle].state; }
+
+    // Meilleur ordre de chaque côté (tête de file du meilleur niveau), NULL_HANDLE si le côté est vide
+    OrderHandle bestBuy() const;
+    OrderHandle bestSell() const;
+
+    // Nombre d'ordres au repos de chaque côté
+    size_t buySize() const { return buy_count; }
+    size_t sellSize() const { return sell_count; }
+
+    // Nombre de niveaux de prix de chaque côté
+    size_t buyLevels() const { return buy_levels.size(); }
+    size_t sellLevels() const { return sell_levels.size(); }
+
+    // Meilleur prix de chaque côté, gardé en cache (mis à jour à la création / suppression d'un niveau)
+    TopOfBook topOfBook() const;
+
+    // Vrai si un ordre LIMIT de ce côté et à ce prix croise le meilleur prix opposé (en cache, sans parcours)
+    bool crosses(Side side, Price price) const {
+        return (side == Side::BUY) ? price >= best_ask : price <= best_bid;
+    }
+
+    // Les max_levels meilleurs niveaux d'un côté, du meilleur au moins bon, écrits dans out : O(max_levels).
+    // Renvoie le nombre de niveaux écrits.
+    size_t depth(Side side, size_t max_levels, DepthLevel* out) const;
+
+    // Variations des niveaux de prix depuis le dernier clearDeltas (une seule par niveau : la dernière),
+    // enregistrées seulement si le suivi est activé
+    void setTrackDeltas(bool enabled) { track_deltas = enabled; }
+    void clearDeltas() { deltas.clear(); delta_epoch++; }
+    const std::vector<LevelDelta>& levelDeltas() const { return deltas; }
+
+private:
+    // Enregistrement du nouvel agrégat d'un niveau (remplace la variation déjà enregistrée pour ce niveau)
+    void recordDelta(PriceLevel& level, bool is_buy);
+
+    // Recalcul du meilleur prix d'un côté après la suppression d'un niveau
+    void refreshBest(bool is_buy);
+
+    // Réserve des noeuds de niveaux (déclarée avant les maps : elle doit leur survivre)
+    SlabPool level_pool;
+    LevelMap buy_levels;
+    LevelMap sell_levels;
+
+    // Stockage des noeuds (les handles sont des indices) et tête de la liste des emplacements libérés à recycler
+    std::vector<BookNode> nodes;
+    OrderHandle free_head;
+
+    size_t buy_count;
+    size_t sell_count;
+
+    // Meilleurs prix en cache (INT64_MIN / INT64_MAX si le côté est vide : aucun prix ne les croise)
+    Price best_bid;
+    Price best_ask;
+
+    // Variations des niveaux pour l'ordre en cours
+    bool track_deltas;
+    uint64_t delta_epoch;
+    std::vector<LevelDelta> deltas;
+};
+
+#endif
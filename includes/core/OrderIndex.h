@@ -0,0 +1,63 @@
+#ifndef ORDER_INDEX_H
+#define ORDER_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "core/OrderBook.h"  // Pour OrderHandle
+
+// Index des ordres au repos : ID de l'ordre -> handle dans le carnet.
+// Table de hachage à adressage ouvert (sondage linéaire) : toutes les entrées sont dans un seul tableau
+// contigu de paires (ID, handle) de 8 octets, sans allocation par entrée comme dans une std::map.
+// - recherche / insertion / suppression : O(1) en moyenne
+// - la suppression décale les entrées suivantes (backward shift) : pas de "pierres tombales",
+//   la table reste aussi rapide après des millions d'annulations
+// - la capacité est toujours une puissance de 2 et double quand le taux de remplissage dépasse 70%
+class OrderIndex {
+public:
+    // Constructeur (capacité initiale arrondie à la puissance de 2 supérieure)
+    explicit OrderIndex(size_t initial_capacity = 1024);
+
+    // Recherche du handle d'un ordre, NULL_HANDLE si l'ID n'est pas dans l'index
+    OrderHandle find(int order_id) const;
+
+    // Insertion (ou mise à jour) du handle d'un ordre
+    void insert(int order_id, OrderHandle handle);
+
+    // Suppression d'un ordre de l'index, renvoie false si l'ID n'y était pas
+    bool erase(int order_id);
+
+    // Pré-allocation pour un nombre d'ordres vivants donné (évite les rehash en cours de traitement)
+    void reserve(size_t expected_orders);
+
+    // Nombre d'ordres dans l'index
+    size_t size() const { return count; }
+
+private:
+    // Une case vide est repérée par handle == NULL_HANDLE (tous les ID, même négatifs, restent utilisables)
+    struct Slot {
+        int32_t order_id;
+        OrderHandle handle;
+    };
+
+    std::vector<Slot> slots;
+    size_t mask;   // capacité - 1
+    size_t count;
+
+    // Position idéale d'un ID dans la table
+    size_t bucket(int order_id) const {
+        // Mélange des bits (finaliseur de MurmurHash3) : des ID consécutifs ne tombent pas dans des cases voisines
+        uint32_t h = static_cast<uint32_t>(order_id);
+        h ^= h >> 16;
+        h *= 0x85ebca6bU;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35U;
+        h ^= h >> 16;
+        return h & mask;
+    }
+
+    // Reconstruction de la table avec une nouvelle capacité
+    void rehash(size_t new_capacity);
+};
+
+#endif
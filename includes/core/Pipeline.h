@@ -0,0 +1,76 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/MatchingEngine.h"
+#include "utils/SpscQueue.h"
+
+// Mesures d'une exécution du pipeline. Le temps de chaque étage ne compte que son travail (hors attente
+// des files) : le temps total doit se rapprocher de celui de l'étage le plus lent.
+struct PipelineStats {
+    size_t orders;
+    size_t results;
+    size_t failed_files;     // fichiers de sortie qui n'ont pas pu être ouverts ou écrits entièrement
+    double total_seconds;
+    double read_seconds;
+    double parse_seconds;
+    double match_seconds;
+    double format_seconds;
+    double write_seconds;
+
+    PipelineStats() : orders(0), results(0), failed_files(0), total_seconds(0.0), read_seconds(0.0),
+                      parse_seconds(0.0), match_seconds(0.0), format_seconds(0.0), write_seconds(0.0) {}
+};
+
+// Traitement d'un fichier en pipeline : lecture -> validation -> matching -> formatage -> écriture.
+// Chaque étage tourne sur son propre thread et passe des lots (lignes brutes, puis ordres, puis résultats)
+// à l'étage suivant par une file SPSC bornée : pendant que le lot k est apparié, le lot k+1 est validé,
+// le lot k+2 lu et le lot k-1 formaté.
+// Seuls les lots en transit sont en mémoire (jamais le fichier entier).
+// Les ordres sont traités dans l'ordre du fichier, qui doit donc être chronologique (comme un flux) :
+// contrairement à processAllOrders, le pipeline ne peut pas trier les ordres.
+// Les résultats sont écrits dans "<output_prefix><actif>.csv", un fichier par actif, comme le traitement par lot.
+class Pipeline {
+public:
+    Pipeline(std::string input_file, std::string output_prefix, size_t batch_size = 4096, size_t queue_depth = 8);
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    // Exécution complète (bloquante) : démarre les cinq étages et attend la fin de l'écriture
+    const PipelineStats& run();
+
+    const PipelineStats& stats() const { return stats_; }
+
+private:
+    // Lot formaté : pour chaque actif présent dans le lot, ses lignes de CSV (dans l'ordre)
+    using FormattedBatch = std::vector<std::pair<Instrument, std::string>>;
+
+    // Élément d'une file entre deux étages : un lot, ou std::nullopt pour signaler la fin du flux
+    // à l'étage suivant (un lot vide reste un lot comme un autre)
+    template <typename Batch>
+    using Item = std::optional<Batch>;
+
+    // Étages
+    void readStage();
+    void parseStage();
+    void matchStage();
+    void formatStage();
+    void writeStage();
+
+    std::string input_file;
+    std::string output_prefix;
+    size_t batch_size;
+
+    SpscQueue<Item<std::string>> lines;
+    SpscQueue<Item<std::vector<Order>>> parsed;
+    SpscQueue<Item<std::vector<OrderResult>>> matched;
+    SpscQueue<Item<FormattedBatch>> formatted;
+
+    PipelineStats stats_;
+};
+
+#endif
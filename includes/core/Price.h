@@ -0,0 +1,68 @@
+#ifndef PRICE_H
+#define PRICE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+
+// Prix en nombre entier de ticks (virgule fixe) : les comparaisons sont exactes et peu coûteuses,
+// contrairement aux float (149.8 vs 149.80000001 ne peut plus décider d'un match)
+using Price = int64_t;
+
+// Taille du tick d'un instrument, exprimée sans flottant :
+// tick = units * 10^-decimals (ex : {2, 1} -> 0.01, {2, 5} -> 0.05, {4, 1} -> 0.0001)
+// Un prix de p ticks vaut donc p * units * 10^-decimals.
+struct TickSize {
+    int decimals;
+    int64_t units;
+};
+
+// Tick par défaut : le centime (c'est aussi la précision historique des fichiers de sortie)
+constexpr TickSize DEFAULT_TICK_SIZE = {2, 1};
+
+// Table des tailles de tick par instrument.
+// Les instruments non renseignés utilisent DEFAULT_TICK_SIZE.
+// La table doit être configurée avant la lecture des ordres (elle n'est ensuite plus que lue).
+class TickTable {
+public:
+    // Définition du tick d'un instrument
+    static void set(const std::string& instrument, TickSize tick);
+
+    // Récupération du tick d'un instrument par son nom
+    // (le tick d'un instrument déjà enregistré se lit directement par son ID : Instrument::tick())
+    static TickSize get(std::string_view instrument);
+
+private:
+    static std::map<std::string, TickSize, std::less<>>& table();
+};
+
+// Conversion d'un prix en ticks vers sa valeur décimale (uniquement pour l'affichage / debug)
+inline double priceToDouble(Price price, TickSize tick) {
+    double scale = 1.0;
+    for (int i = 0; i < tick.decimals; i++) {
+        scale *= 10.0;
+    }
+    return static_cast<double>(price * tick.units) / scale;
+}
+
+// Conversion d'un prix en ticks d'un tick à un autre (ex : prix d'un fichier écrit avec un autre tick),
+// arrondi au tick d'arrivée le plus proche, comme à la lecture d'un prix texte (demi-tick arrondi en
+// s'éloignant de zéro, de façon symétrique pour les prix négatifs)
+inline Price convertTicks(Price price, TickSize from, TickSize to) {
+    if (from.decimals == to.decimals && from.units == to.units) {
+        return price;
+    }
+    int64_t numerator = price * from.units;
+    int64_t denominator = to.units;
+    for (int i = from.decimals; i < to.decimals; i++) {
+        numerator *= 10;
+    }
+    for (int i = to.decimals; i < from.decimals; i++) {
+        denominator *= 10;
+    }
+    int64_t magnitude = ((numerator < 0 ? -numerator : numerator) + denominator / 2) / denominator;
+    return numerator < 0 ? -magnitude : magnitude;
+}
+
+#endif
@@ -0,0 +1,164 @@
+#ifndef RESULT_TABLE_H
+#define RESULT_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "data/CSVReader.h"  // Pour accéder à la structure Order
+
+// Structure pour les ordres avec état (pour l'output final, on veut présenter en plus des caractéristiques de l'ordre
+// la quantité exécutée, l'ID de la contrepartie si besoin, le prix d'exécution et naturellement le statut.)
+// C'est la forme "ligne" d'un résultat : l'historique d'un engine est stocké en colonnes (ResultTable),
+// une ligne n'est reconstituée qu'à la lecture (ou pour passer d'un thread à l'autre).
+struct OrderResult {
+    Order original_order;
+    OrderStatus status;           // EXECUTED, PARTIALLY_EXECUTED, PENDING, CANCELED, REJECTED
+    int executed_quantity;
+    Price execution_price;
+    int counterparty_id;
+
+    // Constructeurs (par défaut : pour les buffers préalloués, ex : files entre threads)
+    OrderResult()
+        : original_order(), status(OrderStatus::PENDING), executed_quantity(0),
+          execution_price(0), counterparty_id(0) {}
+    OrderResult(const Order& order)
+        : original_order(order), status(OrderStatus::PENDING), executed_quantity(0),
+          execution_price(0), counterparty_id(0) {}
+};
+
+class ResultView;
+
+// Historique des résultats en colonnes, en ajout seul :
+// une colonne contiguë par champ (timestamp, ID, instrument, codes, quantités, prix, contrepartie),
+// découpée en blocs de CHUNK_SIZE lignes. Un bloc n'est jamais déplacé quand la table grandit
+// (seul le tableau des pointeurs de blocs l'est) : une vue reste valide tant qu'on ne fait qu'ajouter.
+// clear() garde les blocs : en régime établi, l'ajout d'un résultat ne fait aucune allocation.
+class ResultTable {
+public:
+    static constexpr size_t CHUNK_BITS = 10;
+    static constexpr size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+
+    // Un bloc de lignes, colonne par colonne
+    struct Chunk {
+        long long timestamp[CHUNK_SIZE];
+        int order_id[CHUNK_SIZE];
+        InstrumentId instrument[CHUNK_SIZE];
+        Side side[CHUNK_SIZE];
+        OrderType type[CHUNK_SIZE];
+        Action action[CHUNK_SIZE];
+        OrderStatus status[CHUNK_SIZE];
+        int quantity[CHUNK_SIZE];
+        Price price[CHUNK_SIZE];
+        int executed_quantity[CHUNK_SIZE];
+        Price execution_price[CHUNK_SIZE];
+        int counterparty_id[CHUNK_SIZE];
+    };
+
+    ResultTable();
+    ~ResultTable();
+    ResultTable(ResultTable&&) noexcept;
+    ResultTable& operator=(ResultTable&&) noexcept;
+    ResultTable(const ResultTable&) = delete;
+    ResultTable& operator=(const ResultTable&) = delete;
+
+    // Ajout d'un résultat (ordre tel qu'il apparaît dans l'output + exécution)
+    void append(const Order& order, OrderStatus status, int executed_quantity = 0, Price execution_price = 0,
+                int counterparty_id = 0);
+    void append(const OrderResult& result);
+
+    // Allocation à l'avance des blocs nécessaires pour capacity lignes
+    void reserve(size_t capacity);
+
+    // Vidage de la table (les blocs sont gardés pour les ajouts suivants)
+    void clear() { count_ = 0; }
+
+    // Échange du contenu (et des blocs) de deux tables, sans copie ni allocation
+    void swap(ResultTable& other) noexcept;
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    size_t capacity() const { return chunks_.size() * CHUNK_SIZE; }
+
+    // Accès colonne par colonne à la ligne i
+    long long timestamp(size_t i) const { return chunkOf(i).timestamp[i & (CHUNK_SIZE - 1)]; }
+    int orderId(size_t i) const { return chunkOf(i).order_id[i & (CHUNK_SIZE - 1)]; }
+    Instrument instrument(size_t i) const { return Instrument::fromId(chunkOf(i).instrument[i & (CHUNK_SIZE - 1)]); }
+    Side side(size_t i) const { return chunkOf(i).side[i & (CHUNK_SIZE - 1)]; }
+    OrderType type(size_t i) const { return chunkOf(i).type[i & (CHUNK_SIZE - 1)]; }
+    Action action(size_t i) const { return chunkOf(i).action[i & (CHUNK_SIZE - 1)]; }
+    OrderStatus status(size_t i) const { return chunkOf(i).status[i & (CHUNK_SIZE - 1)]; }
+    int quantity(size_t i) const { return chunkOf(i).quantity[i & (CHUNK_SIZE - 1)]; }
+    Price price(size_t i) const { return chunkOf(i).price[i & (CHUNK_SIZE - 1)]; }
+    int executedQuantity(size_t i) const { return chunkOf(i).executed_quantity[i & (CHUNK_SIZE - 1)]; }
+    Price executionPrice(size_t i) const { return chunkOf(i).execution_price[i & (CHUNK_SIZE - 1)]; }
+    int counterpartyId(size_t i) const { return chunkOf(i).counterparty_id[i & (CHUNK_SIZE - 1)]; }
+
+    // Ligne i reconstituée (aucune allocation : un OrderResult ne contient pas de chaîne)
+    OrderResult operator[](size_t i) const;
+
+    // Blocs bruts, pour les boucles sur une colonne (le dernier bloc n'est rempli que jusqu'à size())
+    size_t chunkCount() const { return (count_ + CHUNK_SIZE - 1) >> CHUNK_BITS; }
+    const Chunk& chunk(size_t c) const { return *chunks_[c]; }
+
+    // Vue sur toute la table, ou sur les lignes [begin, end)
+    ResultView view() const;
+    ResultView view(size_t begin, size_t end) const;
+
+private:
+    const Chunk& chunkOf(size_t i) const { return *chunks_[i >> CHUNK_BITS]; }
+
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    size_t count_;
+};
+
+// Vue (sans copie) sur une suite de lignes consécutives d'une ResultTable.
+// Les lignes sont lues à la demande : operator[] et l'itération renvoient un OrderResult reconstitué.
+// La vue ne possède rien : la table doit rester en vie (et ne pas être vidée) tant qu'elle est utilisée.
+class ResultView {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = OrderResult;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = OrderResult;
+
+        Iterator(const ResultTable* table, size_t index) : table_(table), index_(index) {}
+        OrderResult operator*() const { return (*table_)[index_]; }
+        Iterator& operator++() { index_++; return *this; }
+        bool operator==(const Iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const ResultTable* table_;
+        size_t index_;
+    };
+
+    ResultView() : table_(nullptr), begin_(0), end_(0) {}
+    ResultView(const ResultTable& table) : table_(&table), begin_(0), end_(table.size()) {}
+    ResultView(const ResultTable& table, size_t begin, size_t end) : table_(&table), begin_(begin), end_(end) {}
+
+    size_t size() const { return end_ - begin_; }
+    bool empty() const { return end_ == begin_; }
+
+    OrderResult operator[](size_t i) const { return (*table_)[begin_ + i]; }
+    Iterator begin() const { return Iterator(table_, begin_); }
+    Iterator end() const { return Iterator(table_, end_); }
+
+    // Table sous-jacente et position de la première ligne, pour l'accès direct aux colonnes
+    const ResultTable& table() const { return *table_; }
+    size_t offset() const { return begin_; }
+
+private:
+    const ResultTable* table_;
+    size_t begin_;
+    size_t end_;
+};
+
+inline ResultView ResultTable::view() const { return ResultView(*this); }
+inline ResultView ResultTable::view(size_t begin, size_t end) const { return ResultView(*this, begin, end); }
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef SHARDED_ENGINE_H
+#define SHARDED_ENGINE_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/MatchingEngine.h"
+#include "utils/SpscQueue.h"
+
+// Mode continu du matching engine, réparti sur plusieurs threads ("shards").
+// - un seul thread routeur appelle submit() : chaque ordre est envoyé au shard de son instrument
+//   (ID d'instrument modulo le nombre de shards), via une file SPSC sans verrou propre à ce shard
+// - chaque shard a son thread (épinglé sur un coeur si demandé) et possède un MatchingEngine par instrument :
+//   aucun état n'est partagé entre shards, les ordres d'un instrument sont traités dans leur ordre d'arrivée
+// - les résultats repartent par une file SPSC de sortie par shard, lue par un seul thread collecteur (pollResults)
+// Contre-pression : si la file de sortie est pleine, les résultats de l'ordre en cours attendent dans un
+// buffer local du shard, et le shard ne prend plus d'ordre tant que ce buffer n'est pas vidé (sa file
+// d'entrée se remplit et le routeur attend dans submit) : un collecteur lent ne fait pas grossir la mémoire.
+// Le collecteur doit donc tourner pendant l'envoi des ordres. Après stop(), les ordres encore en file sont
+// traités sans attendre le collecteur (le buffer reste borné par la capacité de la file d'entrée) et leurs
+// résultats sont récupérables par pollResults.
+class ShardedEngine {
+public:
+    // Constructeur : démarre shard_count threads (0 = un par coeur)
+    explicit ShardedEngine(size_t shard_count, size_t queue_capacity = 65536, bool pin_threads = true);
+
+    // Destructeur : arrête les shards s'ils tournent encore
+    ~ShardedEngine();
+
+    ShardedEngine(const ShardedEngine&) = delete;
+    ShardedEngine& operator=(const ShardedEngine&) = delete;
+
+    // Envoi d'un ordre à son shard (thread routeur uniquement). Attend si la file du shard est pleine.
+    void submit(const Order& order);
+
+    // Récupération des résultats disponibles de tous les shards, ajoutés à la fin de out
+    // (thread collecteur uniquement, qui peut tourner en même temps que stop()). Renvoie le nombre de résultats récupérés.
+    size_t pollResults(std::vector<OrderResult>& out);
+
+    // Fin du flux (thread routeur) : attend que tous les ordres envoyés soient traités puis arrête les threads
+    void stop();
+
+    // Shard d'un instrument
+    size_t shardOf(Instrument instrument) const;
+
+    size_t shardCount() const { return shards.size(); }
+
+private:
+    struct Shard {
+        Shard(size_t queue_capacity) : input(queue_capacity), output(queue_capacity), backlog_pos(0) {}
+
+        SpscQueue<Order> input;
+        SpscQueue<OrderResult> output;
+
+        // Uniquement manipulés par le thread du shard (puis par pollResults une fois le thread arrêté)
+        std::vector<std::unique_ptr<MatchingEngine>> engines;   // indexés par ID d'instrument
+        std::vector<OrderResult> backlog;   // résultats pas encore passés dans la file de sortie
+        size_t backlog_pos;
+
+        std::thread thread;
+    };
+
+    void run(Shard& shard);
+    void flushBacklog(Shard& shard);
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<bool> running;
+    std::atomic<bool> stopped;     // écrit par stop() après l'arrêt des threads, lu par le collecteur
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "core/Price.h"
+
+// Identifiant dense d'un instrument (0, 1, 2, ... dans l'ordre d'enregistrement)
+using InstrumentId = uint32_t;
+
+// ID d'aucun instrument (instrument par défaut)
+constexpr InstrumentId INVALID_INSTRUMENT_ID = UINT32_MAX;
+
+// Capacité de la table des symboles. Le dernier ID est réservé aux noms refusés par une table pleine :
+// jamais attribué à un nom lu, affiché avec UNKNOWN_INSTRUMENT (les ordres concernés sont rejetés).
+constexpr size_t SYMBOL_TABLE_CAPACITY = size_t(1) << 22;
+constexpr InstrumentId OVERFLOW_INSTRUMENT_ID = static_cast<InstrumentId>(SYMBOL_TABLE_CAPACITY - 1);
+constexpr const char* UNKNOWN_INSTRUMENT = "UNKNOWN";
+
+// Table des symboles : chaque nom d'instrument est enregistré une seule fois (au parsing) et reçoit un ID.
+// Les ordres et les résultats ne portent que cet ID ; le nom n'est relu qu'à l'écriture des résultats.
+// - intern : recherche / enregistrement sous verrou (un seul appel par ligne lue)
+// - name / tick : lecture sans verrou (les entrées ne sont jamais déplacées une fois créées),
+//   utilisables depuis n'importe quel thread pour un ID déjà obtenu
+class SymbolTable {
+public:
+    // ID d'un nom d'instrument (enregistré s'il est nouveau).
+    // Si la table est pleine, l'erreur est signalée et OVERFLOW_INSTRUMENT_ID est renvoyé : l'appelant doit
+    // rejeter l'ordre (jamais l'ID d'un autre instrument).
+    static InstrumentId intern(std::string_view name);
+
+    // Nom d'un instrument (chaîne vide pour un ID inconnu)
+    static const std::string& name(InstrumentId id);
+
+    // Taille du tick d'un instrument (copiée de la TickTable à l'enregistrement, puis tenue à jour par TickTable::set)
+    static TickSize tick(InstrumentId id);
+
+    // Nombre d'instruments enregistrés (les IDs valides sont 0 .. size() - 1)
+    static size_t size();
+
+private:
+    friend class TickTable;
+
+    // Mise à jour du tick d'un instrument déjà enregistré (appelée par TickTable::set)
+    static void updateTick(std::string_view name, TickSize tick);
+};
+
+// Instrument d'un ordre : son ID dans la table des symboles (4 octets, aucune chaîne stockée).
+// Construit explicitement depuis un nom (enregistré au passage) : Order{..., Instrument("AAPL"), ...}.
+struct Instrument {
+    InstrumentId id;
+
+    Instrument() : id(INVALID_INSTRUMENT_ID) {}
+    explicit Instrument(const char* name) : id(SymbolTable::intern(name)) {}
+    explicit Instrument(const std::string& name) : id(SymbolTable::intern(name)) {}
+    explicit Instrument(std::string_view name) : id(SymbolTable::intern(name)) {}
+
+    // Instrument d'un ID déjà enregistré
+    static Instrument fromId(InstrumentId id) {
+        Instrument instrument;
+        instrument.id = id;
+        return instrument;
+    }
+
+    // L'instrument a-t-il été enregistré sous son nom ? (false : instrument par défaut, ou nom refusé par
+    // une table des symboles pleine)
+    bool isValid() const { return id != INVALID_INSTRUMENT_ID && id != OVERFLOW_INSTRUMENT_ID; }
+
+    const std::string& name() const { return SymbolTable::name(id); }
+    TickSize tick() const { return SymbolTable::tick(id); }
+};
+
+inline bool operator==(Instrument a, Instrument b) { return a.id == b.id; }
+inline bool operator!=(Instrument a, Instrument b) { return a.id != b.id; }
+inline bool operator<(Instrument a, Instrument b) { return a.id < b.id; }
+
+// Affichage du nom (debug, tests)
+inline std::ostream& operator<<(std::ostream& os, Instrument instrument) { return os << instrument.name(); }
+
+#endif
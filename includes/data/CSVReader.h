@@ -1,24 +1,121 @@
 #ifndef CSV_READER_H
 #define CSV_READER_H
 
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <vector>
-#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "core/Price.h"
+#include "core/SymbolTable.h"
+
+// Côté, type et action d'un ordre, codés sur un octet.
+// La conversion depuis / vers le texte du CSV ne se fait que dans CsvReader (lecture) et CsvWriter (écriture) :
+// le matching engine ne manipule que ces codes.
+enum class Side : uint8_t { BUY, SELL };
+enum class OrderType : uint8_t { LIMIT, MARKET, BAD_INPUT };
+enum class Action : uint8_t { NEW, MODIFY, CANCEL };
+
+// Statut d'un ordre dans l'historique (converti en texte à l'écriture des résultats)
+enum class OrderStatus : uint8_t { PENDING, EXECUTED, PARTIALLY_EXECUTED, CANCELED, REJECTED };
+
+// Une ligne BAD_INPUT peut contenir un côté ou une action inconnus (ex : "ERROR", "TEST") qu'on doit
+// pourtant recopier tels quels dans l'output. Ces libellés bruts sont stockés une seule fois dans RawLabels
+// et l'ordre garde seulement leur code (toujours >= FIRST_RAW_LABEL, donc distinct des valeurs connues).
+constexpr uint8_t FIRST_RAW_LABEL = 16;
+
+// Code d'un libellé brut refusé (table pleine) : jamais attribué, affiché avec UNKNOWN_RAW_LABEL
+constexpr uint8_t OVERFLOW_RAW_LABEL = UINT8_MAX;
+constexpr const char* UNKNOWN_RAW_LABEL = "UNKNOWN";
+
+class RawLabels {
+public:
+    // Enregistrement d'un libellé brut (une seule fois), renvoie son code.
+    // Si la table est pleine, l'erreur est signalée et OVERFLOW_RAW_LABEL est renvoyé.
+    static uint8_t intern(std::string_view label);
+
+    // Le code désigne-t-il un libellé brut enregistré ?
+    static bool contains(uint8_t code);
 
+    // Récupération du libellé brut associé à un code (UNKNOWN_RAW_LABEL pour un code non enregistré)
+    static const std::string& get(uint8_t code);
+};
 
 // Création d'une structure de donnée associée à un ordre 
 struct Order{
     long long timestamp;
     int order_id;
-    std::string instrument; 
-    std::string side;
-    std::string type;
+    Instrument instrument;    // ID dans la table des symboles (le nom n'est relu qu'à l'écriture)
+    Side side;
+    OrderType type;
     int quantity;
-    float price;
-    std::string action;
+    Price price;          // En ticks (voir TickTable pour la taille du tick de l'instrument)
+    Action action;
 };
 
+// Vue (sans copie) sur une suite d'ordres stockés dans un tableau contigu :
+// soit tous les ordres du tableau, soit ceux désignés par une liste d'indices (ex : les ordres d'un instrument).
+// La vue ne possède rien : le tableau (et la liste d'indices) doivent rester en vie tant qu'elle est utilisée.
+class OrderView {
+public:
+    // Vue sur tous les ordres d'un vecteur
+    explicit OrderView(const std::vector<Order>& orders)
+        : orders_(orders.data()), indices_(nullptr), count_(orders.size()) {}
+
+    // Vue sur count ordres consécutifs (span : ex, une tranche d'un tableau ou un buffer de l'appelant)
+    OrderView(const Order* orders, size_t count) : orders_(orders), indices_(nullptr), count_(count) {}
+
+    // Vue sur les ordres d'un vecteur désignés par leurs indices
+    OrderView(const std::vector<Order>& orders, const std::vector<uint32_t>& indices)
+        : orders_(orders.data()), indices_(indices.data()), count_(indices.size()) {}
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    // i-ème ordre de la vue
+    const Order& operator[](size_t i) const {
+        return (indices_ == nullptr) ? orders_[i] : orders_[indices_[i]];
+    }
+
+private:
+    const Order* orders_;
+    const uint32_t* indices_;
+    size_t count_;
+};
+
+// Conversion texte -> code, sans contrôle : les libellés inconnus sont conservés comme libellés bruts
+// (utilisé pour recopier les champs d'une ligne BAD_INPUT)
+Side parseSide(std::string_view label);
+Action parseAction(std::string_view label);
+
+// Conversion code -> texte (libellés du CSV)
+const char* toLabel(Side side);
+const char* toLabel(OrderType type);
+const char* toLabel(Action action);
+const char* toLabel(OrderStatus status);
+
+// Affichage des codes sous forme de texte (debug, tests)
+inline std::ostream& operator<<(std::ostream& os, Side side) { return os << toLabel(side); }
+inline std::ostream& operator<<(std::ostream& os, OrderType type) { return os << toLabel(type); }
+inline std::ostream& operator<<(std::ostream& os, Action action) { return os << toLabel(action); }
+inline std::ostream& operator<<(std::ostream& os, OrderStatus status) { return os << toLabel(status); }
+
+// Nombre de champs d'une ligne du CSV (timestamp, order_id, instrument, side, type, quantity, price, action)
+constexpr size_t CSV_FIELD_COUNT = 8;
+
+// Champs d'une ligne : vues directement sur le contenu du fichier (aucune copie)
+using CsvRow = std::array<std::string_view, CSV_FIELD_COUNT>;
+
+// Résultat de la validation d'un champ : les méthodes de test renvoient un code d'erreur au lieu de lever
+// une exception (sur un fichier contenant beaucoup de lignes invalides, le coût des exceptions dominait la lecture)
+enum class ParseError : uint8_t { NONE, BAD_TIMESTAMP, BAD_ID, BAD_INSTRUMENT, BAD_SIDE, BAD_TYPE, BAD_QUANTITY, BAD_PRICE, BAD_ACTION };
+
 // Création d'une classe pour lire un fichier au format CSV
+// Le fichier est projeté en mémoire (mmap) et les champs sont lus sur place : pas de flux, pas de chaîne
+// intermédiaire par ligne ou par champ. Les méthodes de test prennent donc des string_view.
 class CsvReader {
 public:
     // Construction et destructeur par défaut
@@ -29,8 +126,22 @@ public:
     CsvReader(std::string filename);
 
     // Récupération des ordres du csv sous forme de vecteur
+    // (un fichier converti en colonnes par build/tools/csv_to_columns est reconnu et chargé sans parsing)
     void init();
 
+    // Lecture du csv par lots de batch_size ordres (dans l'ordre du fichier), passés un par un à on_batch.
+    // Les ordres ne sont pas conservés dans le reader. Renvoie le nombre total d'ordres lus.
+    size_t readBatches(size_t batch_size, const std::function<void(std::vector<Order>&)>& on_batch);
+
+    // Même lecture en deux temps, pour séparer la lecture de la validation (ex : deux étages du pipeline) :
+    // readLineBatches passe à on_batch des lots de batch_size lignes de données, en texte brut (lignes entières,
+    // sans la ligne de titre), sans les valider. Renvoie le nombre de lignes lues.
+    size_t readLineBatches(size_t batch_size, const std::function<void(std::string&)>& on_batch);
+
+    // Validation d'un lot de lignes lu par readLineBatches : ordres ajoutés à la fin de out
+    // (lignes incomplètes ignorées, comme à la lecture directe)
+    void parseLines(std::string_view lines, std::vector<Order>& out);
+
     // Affichage des ordres (debug)
     void Display();
 
@@ -40,38 +151,57 @@ public:
     }
 
     // Méthode pour tester la validité d'un ordre
-    Order testOrder(std::vector<std::string>);
+    Order testOrder(const CsvRow& row);
+
+    // Méthodes de test des champs : la valeur lue est écrite dans le dernier paramètre,
+    // le code renvoyé vaut ParseError::NONE si le champ est valide
 
     // Méthode pour tester la récupération du timestamp
-    long long testTimestamp(std::string rowValue);
+    ParseError testTimestamp(std::string_view rowValue, long long& timestamp);
 
-    // Méthode pour tester l'id
-    int testId(std::string rowValue);
+    // Méthode pour tester l'id (strictement positif)
+    ParseError testId(std::string_view rowValue, int& id);
 
     // Méthode pour tester le side
-    std::string testSide(std::string rowValue);
+    ParseError testSide(std::string_view rowValue, Side& side);
 
     // Méthode pour tester le type d'ordre
-    std::string testType(std::string rowValue);
+    ParseError testType(std::string_view rowValue, OrderType& type);
 
     // Méthode pour tester la quantité
-    int testQuantity(std::string rowValue);
+    ParseError testQuantity(std::string_view rowValue, int& quantity);
 
-    // Méthode pour tester le prix
-    float testPrice(std::string rowValue, std::string orderType);
+    // Méthode pour tester le prix (converti directement du texte en ticks de l'instrument)
+    ParseError testPrice(std::string_view rowValue, OrderType orderType, Instrument instrument, Price& price);
 
     // Méthode pour tester le type d'action
-    std::string testAction(std::string rowValue);
+    ParseError testAction(std::string_view rowValue, Action& action);
+
+    // Getter pour récupérer les ordres de chaque actif : une vue par actif sur le tableau des ordres
+    // (aucun ordre n'est copié, les vues restent valides tant que le CsvReader existe)
+    std::map<std::string, OrderView> getMapOrder() const;
 
-    // Getter pour récupérer la liste des ordres / la map des ordres par actif
-    std::vector<Order> getOrder(){return orders;}
-    std::map<std::string, std::vector<Order>> getMapOrder(){return map_orders_asset;}
+    // Mêmes vues, indexées par ID d'instrument (tableau plat, uniquement les actifs présents dans le fichier)
+    std::vector<std::pair<Instrument, OrderView>> getInstrumentViews() const;
 
 private:
-    std::fstream file_;
+    // Parcours des lignes de données du fichier : callback(const CsvRow&) pour chaque ligne complète
+    template <typename Callback>
+    bool forEachRow(bool reserve_orders, Callback&& callback);
+
+    // Chargement d'un fichier en colonnes (voir OrderColumns.h)
+    void loadColumns();
+
+    std::string filename_;
+
+    // Tous les ordres, dans l'ordre du fichier : chaque ordre n'est stocké qu'une seule fois
     std::vector<Order> orders;
-    std::map<std::string, std::vector<Order>> map_orders_asset;
-    // std::map<int, std::vector<Order>> map_orders_asset;
+
+    // Pour chaque actif (indexé par son ID), indices de ses ordres dans le tableau des ordres (dans l'ordre du fichier)
+    std::vector<std::vector<uint32_t>> instrument_indices;
+
+    // Ajout d'un ordre à la liste de son actif
+    void indexOrder(uint32_t index);
 };
 
 #endif
\ No newline at end of file
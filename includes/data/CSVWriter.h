@@ -3,9 +3,17 @@
 
 #include <vector>
 #include <iostream>
+#include <fstream>
+#include <string>
 #include "core/MatchingEngine.h"  // Pour accéder à la structure OrderResults
 
+// Taille des blocs écrits dans le fichier : les lignes sont formatées dans un buffer réutilisé,
+// vidé dans le fichier chaque fois qu'il atteint cette taille (et à la fin)
+constexpr size_t WRITE_BUFFER_SIZE = 1 << 20;
+
 // Création d'une classe pour construire un fichier au format csv
+// Les lignes sont formatées directement dans un buffer (std::to_chars pour les entiers, prix écrits
+// en entier à partir des ticks) : pas de chaîne intermédiaire par champ, ni de flux par prix.
 class CsvWriter{
 public :
 
@@ -17,13 +25,56 @@ public :
     CsvWriter(std::string filename);
 
     // Ecriture dans le fichier à partir des résultats du matching engine
-    void WriteToCsv(std::vector<OrderResult>);
+    // (vue sur l'historique en colonnes d'un engine, ou résultats déjà sous forme de lignes)
+    void WriteToCsv(ResultView resOrders);
+    void WriteToCsv(const std::vector<OrderResult>& resOrders);
 
     // Méthode permettant de transformer les attributs d'un OrderResult en chaine de caractère
-    std::string OrderToString(OrderResult order);
+    std::string OrderToString(const OrderResult& order);
+
+    // Ajout d'une ligne du CSV (résultat formaté + fin de ligne) à la fin d'un buffer.
+    // Les prix sont formatés avec le tick de l'instrument, ou avec le tick donné (ex : tick d'un journal binaire).
+    void appendRow(const OrderResult& order, std::string& out);
+    void appendRow(const OrderResult& order, TickSize tick, std::string& out);
+
+    // Ligne de titre du CSV de sortie
+    static const char* header();
 
 private:
     std::string filename; 
-    std::string formatPrice(float price);
+
+    // Buffer de sortie (garde sa capacité d'un appel à WriteToCsv à l'autre)
+    std::string buffer;
+
+    // Ajout d'un prix en ticks, au format décimal, à la fin d'un buffer
+    static void appendPrice(Price price, TickSize tick, std::string& out);
+
+    // Ecriture de toutes les lignes d'une suite de résultats (vue ou vecteur), par blocs
+    template <typename Results>
+    void writeRows(const Results& resOrders);
+};
+
+// Écriture du CSV au fil de l'eau : abonné aux événements d'un matching engine, chaque résultat est formaté
+// dès qu'il est produit et le fichier est écrit par blocs. Aucun résultat n'est conservé : un engine sans
+// historique (EngineConfig::keep_history) peut traiter un flux de taille quelconque.
+class CsvStreamWriter : public EngineListener {
+public:
+    // Création du fichier et écriture de la ligne de titre
+    explicit CsvStreamWriter(const std::string& filename);
+
+    // Écriture de ce qui reste dans le buffer
+    ~CsvStreamWriter() override;
+
+    bool isOpen() const { return output_file.is_open(); }
+
+    void onResult(const OrderResult& result) override;
+
+    // Écriture immédiate du buffer dans le fichier
+    void flush();
+
+private:
+    CsvWriter formatter;
+    std::ofstream output_file;
+    std::string buffer;
 };
 #endif
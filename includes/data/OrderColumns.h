@@ -0,0 +1,115 @@
+#ifndef ORDER_COLUMNS_H
+#define ORDER_COLUMNS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "data/CSVReader.h"
+#include "data/ResultLog.h"
+#include "utils/MappedFile.h"
+
+// ################################################################################################
+// Fichier d'ordres en colonnes : conversion unique d'un CSV d'input, pour le rejouer sans le reparser.
+// Fichier little-endian, lisible directement par mmap :
+//   - en-tête OrderColumnsHeader (magic "OBOC", version, nombres d'entrées, position de chaque colonne)
+//   - dictionnaire des instruments (mêmes entrées ResultLogSymbol que le journal de résultats : tick
+//     et nom), puis les libellés bruts des lignes BAD_INPUT (entrées ResultLogLabel)
+//     Les prix sont en ticks du fichier : à la lecture, ils sont convertis dans le tick de l'instrument
+//     de ce processus (la TickTable n'est pas modifiée par l'ouverture d'un fichier).
+//   - une colonne par champ, chacune alignée sur 8 octets :
+//       timestamps : écart avec le timestamp précédent, en varint zigzag (1 à 10 octets, souvent 2 ou 3)
+//       IDs, quantités (int32), prix en ticks (int64) : largeur fixe
+//       instrument (uint16), côté, type, action (uint8) : codes du dictionnaire / des enums
+// ################################################################################################
+
+constexpr char ORDER_COLUMNS_MAGIC[4] = {'O', 'B', 'O', 'C'};
+constexpr uint16_t ORDER_COLUMNS_VERSION = 1;
+
+struct OrderColumnsHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t instrument_count;
+    uint32_t raw_label_count;
+    uint64_t row_count;
+    uint64_t timestamp_offset;
+    uint64_t timestamp_bytes;
+    uint64_t order_id_offset;
+    uint64_t quantity_offset;
+    uint64_t price_offset;
+    uint64_t instrument_offset;
+    uint64_t side_offset;
+    uint64_t type_offset;
+    uint64_t action_offset;
+};
+static_assert(sizeof(OrderColumnsHeader) == 96, "Format du fichier en colonnes modifié");
+
+// Écriture d'un fichier en colonnes à partir des ordres lus dans un CSV
+class OrderColumnsWriter {
+public:
+    // Constructeur qui prend le nom d'un fichier en entrée
+    OrderColumnsWriter(std::string filename);
+
+    // Ecriture des ordres (dans l'ordre du tableau). Renvoie false si le fichier n'a pas pu être écrit.
+    bool WriteColumns(const std::vector<Order>& orders);
+
+private:
+    std::string filename;
+};
+
+// Lecture d'un fichier en colonnes par projection mémoire : les colonnes à largeur fixe sont lues sur place,
+// seuls les timestamps (varints, sans accès direct) sont décodés une fois, à l'ouverture
+class OrderColumnsFile {
+public:
+    // Ouverture et contrôle du fichier (isValid() indique si le fichier est lisible)
+    OrderColumnsFile(const std::string& filename);
+
+    OrderColumnsFile(const OrderColumnsFile&) = delete;
+    OrderColumnsFile& operator=(const OrderColumnsFile&) = delete;
+
+    // Le fichier commence-t-il par le magic du format en colonnes ?
+    static bool isColumnFile(const std::string& filename);
+
+    bool isValid() const { return valid_; }
+    size_t size() const { return valid_ ? header_.row_count : 0; }
+
+    // Colonnes (size() valeurs chacune). Les prix sont en ticks du fichier (fileTick).
+    const long long* timestamps() const { return timestamps_.data(); }
+    const int32_t* orderIds() const { return column<int32_t>(header_.order_id_offset); }
+    const int32_t* quantities() const { return column<int32_t>(header_.quantity_offset); }
+    const int64_t* prices() const { return column<int64_t>(header_.price_offset); }
+    const uint16_t* instrumentCodes() const { return column<uint16_t>(header_.instrument_offset); }
+    const uint8_t* sideCodes() const { return column<uint8_t>(header_.side_offset); }
+    const uint8_t* typeCodes() const { return column<uint8_t>(header_.type_offset); }
+    const uint8_t* actionCodes() const { return column<uint8_t>(header_.action_offset); }
+
+    // Dictionnaire des instruments (code du fichier -> instrument enregistré dans la table des symboles,
+    // et tick avec lequel ses prix ont été écrits)
+    size_t instrumentCount() const { return dictionary_.instruments.size(); }
+    Instrument instrument(uint16_t code) const { return dictionary_.instruments[code]; }
+    TickSize fileTick(uint16_t code) const { return dictionary_.ticks[code]; }
+
+    // Champs de la ligne i, dans les conventions de ce processus (libellés bruts traduits, prix dans
+    // le tick de l'instrument)
+    Side side(size_t i) const { return static_cast<Side>(dictionary_.raw_label_codes[sideCodes()[i]]); }
+    Action action(size_t i) const { return static_cast<Action>(dictionary_.raw_label_codes[actionCodes()[i]]); }
+    Price price(size_t i) const;
+
+    // Ordre de la ligne i (aucun parsing : lecture des colonnes)
+    Order order(size_t i) const;
+
+    // Reconstruction des ordres, ajoutés à la fin de out
+    void appendOrders(std::vector<Order>& out) const;
+
+private:
+    template <typename T>
+    const T* column(uint64_t offset) const { return reinterpret_cast<const T*>(file_.data() + offset); }
+
+    MappedFile file_;
+    bool valid_;
+    OrderColumnsHeader header_;
+    FileDictionary dictionary_;    // code du fichier -> instrument de ce processus, codes des libellés bruts
+    std::vector<long long> timestamps_;
+};
+
+#endif
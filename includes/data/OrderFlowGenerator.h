@@ -0,0 +1,78 @@
+#ifndef ORDER_FLOW_GENERATOR_H
+#define ORDER_FLOW_GENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "data/CSVReader.h"
+
+// Paramètres du flux d'ordres synthétique
+struct OrderFlowConfig {
+    uint64_t seed;               // même graine et mêmes paramètres -> même flux, octet pour octet
+    size_t instrument_count;     // instruments AAPL, MSFT, GOOG, ... puis SYM0008, SYM0009, ...
+    double zipf_skew;            // répartition des ordres entre instruments (0 = uniforme, 1 = Zipf classique)
+    double modify_ratio;         // part des MODIFY
+    double cancel_ratio;         // part des CANCEL (le reste : NEW)
+    double market_share;         // part des ordres MARKET parmi les NEW
+    double aggressive_share;     // part des LIMIT placés au-delà du prix milieu (qui croisent le carnet)
+    double volatility;           // écart-type du déplacement du prix milieu à chaque ordre (en ticks)
+    int book_depth;              // nombre de niveaux de prix sur lesquels les LIMIT passifs se répartissent
+    int max_quantity;
+    int64_t initial_mid;         // prix milieu de départ (en ticks de 0.01)
+
+    OrderFlowConfig()
+        : seed(42), instrument_count(3), zipf_skew(1.0), modify_ratio(0.1), cancel_ratio(0.05),
+          market_share(0.05), aggressive_share(0.1), volatility(1.0), book_depth(20), max_quantity(500),
+          initial_mid(15000) {}
+};
+
+// Générateur de flux d'ordres reproductible (générateur pseudo-aléatoire propre, indépendant de la
+// bibliothèque standard : le même flux est produit sur toutes les plateformes).
+// - chaque instrument a un prix milieu qui suit une marche aléatoire gaussienne
+// - les LIMIT passifs sont répartis sur book_depth niveaux de leur côté du prix milieu, les agressifs
+//   jusqu'à quelques niveaux au-delà
+// - les MODIFY / CANCEL visent un ordre déjà émis sur le même instrument (qui a pu être exécuté entre temps :
+//   l'engine le rejette alors, comme en réalité)
+// - les timestamps sont croissants, les IDs uniques
+class OrderFlowGenerator {
+public:
+    explicit OrderFlowGenerator(const OrderFlowConfig& config);
+
+    // Ordre suivant du flux
+    Order next();
+
+    // Ajout d'un ordre au format CSV d'input (sans retour à la ligne) à la fin d'un buffer
+    static void appendCsvRow(const Order& order, std::string& out);
+
+private:
+    // Ordre LIMIT émis, cible possible des MODIFY / CANCEL (un CANCEL reprend ses caractéristiques)
+    struct LiveOrder {
+        int order_id;
+        Side side;
+        int quantity;
+        int64_t price;
+    };
+
+    struct InstrumentState {
+        Instrument instrument;
+        int64_t mid;
+        double mid_drift;                   // partie fractionnaire de la marche aléatoire
+        std::vector<LiveOrder> live_orders;
+    };
+
+    uint64_t nextRandom();
+    double nextUniform();                   // dans [0, 1)
+    uint64_t nextBelow(uint64_t bound);     // dans [0, bound)
+    double nextGaussian();
+    size_t pickInstrument();
+    Order newOrder(InstrumentState& state);
+
+    OrderFlowConfig config;
+    uint64_t rng_state;
+    std::vector<double> instrument_cdf;
+    std::vector<InstrumentState> instruments;
+    long long timestamp;
+    int next_id;
+};
+
+#endif
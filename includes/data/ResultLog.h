@@ -0,0 +1,170 @@
+#ifndef RESULT_LOG_H
+#define RESULT_LOG_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "core/MatchingEngine.h"
+#include "utils/MappedFile.h"
+
+// ################################################################################################
+// Journal binaire des résultats : alternative au CSV de sortie pour les systèmes en aval.
+// Fichier little-endian, lisible directement par mmap :
+//   - en-tête ResultLogHeader (magic "OBRL", version, taille d'un enregistrement, nombres d'entrées)
+//   - table des symboles : pour chaque instrument (dans l'ordre de leurs IDs), un ResultLogSymbol
+//     suivi des octets de son nom ; puis les libellés bruts (côté / action inconnus des lignes BAD_INPUT),
+//     chacun sous la forme ResultLogLabel suivi des octets du libellé
+//   - enregistrements ResultRecord de taille fixe, alignés sur 8 octets, dans l'ordre des résultats
+// Les prix restent en ticks (entiers) : le tick de chaque instrument est dans la table des symboles.
+// ################################################################################################
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Le journal binaire est écrit tel quel en little-endian");
+
+constexpr char RESULT_LOG_MAGIC[4] = {'O', 'B', 'R', 'L'};
+constexpr uint16_t RESULT_LOG_VERSION = 1;
+
+struct ResultLogHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t symbol_count;
+    uint32_t raw_label_count;
+    uint64_t record_count;
+    uint64_t records_offset;     // position du premier enregistrement dans le fichier
+};
+static_assert(sizeof(ResultLogHeader) == 32, "Format du journal binaire modifié");
+
+// Entrée de la table des symboles (suivie de name_length octets)
+struct ResultLogSymbol {
+    int64_t tick_units;
+    int32_t tick_decimals;
+    uint32_t name_length;
+};
+static_assert(sizeof(ResultLogSymbol) == 16, "Format du journal binaire modifié");
+
+// Entrée de la table des libellés bruts (suivie de length octets)
+struct ResultLogLabel {
+    uint8_t code;
+    uint8_t reserved;
+    uint16_t length;
+};
+static_assert(sizeof(ResultLogLabel) == 4, "Format du journal binaire modifié");
+
+// ################################################################################################
+// Dictionnaire commun au journal binaire et au fichier en colonnes (OrderColumns.h) : table des symboles
+// (un ResultLogSymbol suivi du nom, dans l'ordre des IDs du fichier), puis table des libellés bruts
+// (un ResultLogLabel suivi du libellé). Écrit et relu par les mêmes fonctions pour les deux formats.
+// ################################################################################################
+
+// Ajout d'une structure (ou d'octets bruts) à la fin d'un buffer
+template <typename T>
+inline void appendRaw(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Marquage des libellés bruts d'un ordre (côté / action inconnus) parmi les libellés à écrire
+inline void markRawLabels(bool (&raw_label_used)[256], Side side, Action action) {
+    uint8_t side_code = static_cast<uint8_t>(side);
+    uint8_t action_code = static_cast<uint8_t>(action);
+    if (side_code >= FIRST_RAW_LABEL) {
+        raw_label_used[side_code] = true;
+    }
+    if (action_code >= FIRST_RAW_LABEL) {
+        raw_label_used[action_code] = true;
+    }
+}
+
+// Écriture du dictionnaire à la fin de out. Renvoie le nombre de libellés bruts écrits (pour l'en-tête).
+uint32_t writeDictionary(std::string& out, const std::vector<Instrument>& instruments,
+                         const bool (&raw_label_used)[256]);
+
+// Dictionnaire relu : instruments enregistrés dans ce processus (avec le tick du fichier) et traduction
+// des codes de libellés bruts du fichier vers ceux de ce processus
+struct FileDictionary {
+    std::vector<std::string> names;
+    std::vector<Instrument> instruments;
+    std::vector<TickSize> ticks;
+    uint8_t raw_label_codes[256];      // code du fichier -> code RawLabels de ce processus
+    bool raw_label_defined[256];       // codes définis par la table des libellés du fichier
+
+    FileDictionary();
+};
+
+// Lecture d'un dictionnaire de symbol_count symboles et raw_label_count libellés dans data[pos, end)
+// (pos avance jusqu'à la fin du dictionnaire). Renvoie false (erreur signalée) s'il est tronqué, si un
+// instrument ne peut pas être enregistré ou si un code de libellé remplacerait une valeur connue.
+bool readDictionary(const char* data, size_t& pos, size_t end, uint32_t symbol_count, uint32_t raw_label_count,
+                    const std::string& filename, FileDictionary& dictionary);
+
+// Contrôle des codes lus dans un fichier (journal binaire ou fichier en colonnes) : valeur connue de l'enum,
+// ou, pour le côté et l'action, libellé brut défini par la table des libellés du fichier (raw_label_defined)
+bool isValidOrderCodes(uint8_t side, uint8_t type, uint8_t action, const bool (&raw_label_defined)[256]);
+bool isValidStatusCode(uint8_t status);
+
+// Un résultat : mêmes champs que l'OrderResult, instrument remplacé par son ID
+struct ResultRecord {
+    int64_t timestamp;
+    int64_t price;               // en ticks
+    int64_t execution_price;     // en ticks
+    int32_t order_id;
+    int32_t quantity;
+    int32_t executed_quantity;
+    int32_t counterparty_id;
+    uint32_t instrument_id;
+    uint8_t side;
+    uint8_t type;
+    uint8_t action;
+    uint8_t status;
+};
+static_assert(sizeof(ResultRecord) == 48, "Format du journal binaire modifié");
+
+// Écriture d'un journal binaire (même rôle que CsvWriter, sans formatage texte)
+class ResultLogWriter {
+public:
+    // Constructeur qui prend le nom d'un fichier en entrée
+    ResultLogWriter(std::string filename);
+
+    // Ecriture dans le fichier à partir des résultats du matching engine (lus colonne par colonne).
+    // Renvoie false si le fichier n'a pas pu être ouvert ou écrit entièrement.
+    bool WriteToBinary(ResultView resOrders);
+
+private:
+    std::string filename;
+};
+
+// Lecture d'un journal binaire par projection mémoire (les enregistrements sont lus sur place)
+class ResultLogReader {
+public:
+    // Ouverture et contrôle du fichier (isValid() indique si le fichier est un journal lisible : en-tête,
+    // tables, ID d'instrument et codes de chaque enregistrement compris)
+    ResultLogReader(const std::string& filename);
+
+    ResultLogReader(const ResultLogReader&) = delete;
+    ResultLogReader& operator=(const ResultLogReader&) = delete;
+
+    bool isValid() const { return valid_; }
+
+    size_t size() const { return valid_ ? header_.record_count : 0; }
+    const ResultRecord& record(size_t index) const { return records_[index]; }
+
+    // Symbole (nom et tick) d'un ID d'instrument
+    const std::string& symbol(uint32_t instrument_id) const { return dictionary_.names[instrument_id]; }
+    TickSize tick(uint32_t instrument_id) const { return dictionary_.ticks[instrument_id]; }
+
+    // Reconstruction du résultat complet d'un enregistrement (prix en ticks du journal : tick(instrument_id))
+    OrderResult toOrderResult(size_t index) const;
+
+    // Rendu du journal au format CSV de sortie habituel, prix formatés avec les ticks du journal
+    // (la TickTable n'est pas modifiée). Renvoie false si le journal est illisible.
+    bool writeCsv(const std::string& csv_filename) const;
+
+private:
+    MappedFile file_;
+    bool valid_;
+    ResultLogHeader header_;
+    const ResultRecord* records_;
+    FileDictionary dictionary_;    // ID du fichier -> instrument de ce processus, codes des libellés bruts
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Histogramme de latences à précision relative constante (même principe que HdrHistogram) :
+// les valeurs < 256 sont comptées exactement, au-delà chaque puissance de 2 est découpée en 128 intervalles,
+// soit une erreur relative inférieure à 1% sur toute la plage des uint64_t, avec un tableau de taille fixe.
+// L'enregistrement est un simple incrément (aucune allocation) : on peut enregistrer chaque ordre.
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    // Enregistrement d'une valeur (en nanosecondes pour les latences)
+    void record(uint64_t value);
+
+    // Valeur au percentile p (entre 0 et 100) : plus grande valeur de l'intervalle qui contient le percentile
+    // (jamais au-dessus du maximum observé)
+    uint64_t percentile(double p) const;
+
+    size_t count() const { return total_count; }
+    uint64_t min() const { return total_count == 0 ? 0 : min_value; }
+    uint64_t max() const { return max_value; }
+    double mean() const { return total_count == 0 ? 0.0 : static_cast<double>(sum) / total_count; }
+
+    // Ajout des valeurs d'un autre histogramme
+    void merge(const LatencyHistogram& other);
+
+    void reset();
+
+private:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr size_t SUB_BUCKET_COUNT = size_t(1) << SUB_BUCKET_BITS;
+
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketHighestValue(size_t index);
+
+    std::vector<uint64_t> counts;
+    size_t total_count;
+    uint64_t min_value;
+    uint64_t max_value;
+    uint64_t sum;
+};
+
+#endif
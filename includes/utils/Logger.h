@@ -0,0 +1,168 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+// ###########################################################################################################
+// NIVEAUX DE LOG (choisis à la compilation)
+// ###########################################################################################################
+// Le niveau minimal est fixé par -DLOG_LEVEL=... (voir le Makefile). Les macros des niveaux inférieurs
+// sont remplacées par ((void)0) : leurs arguments ne sont même pas évalués, le coût est nul.
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE  4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+enum class LogLevel : uint8_t { DEBUG, INFO, WARN, ERROR };
+
+// Taille maximale d'un message (au-delà, le message est tronqué)
+constexpr size_t LOG_LINE_CAPACITY = 240;
+
+// Un message de log : texte déjà formaté dans un tableau de taille fixe (aucune allocation)
+struct LogLine {
+    LogLevel level;
+    uint16_t length;
+    char text[LOG_LINE_CAPACITY];
+
+    void append(std::string_view value) {
+        size_t n = std::min(value.size(), LOG_LINE_CAPACITY - length);
+        std::memcpy(text + length, value.data(), n);
+        length += static_cast<uint16_t>(n);
+    }
+    void append(const char* value) { append(std::string_view(value)); }
+    void append(const std::string& value) { append(std::string_view(value)); }
+    void append(char value) { append(std::string_view(&value, 1)); }
+
+    // Nombres : conversion directe dans le tableau (std::to_chars, sans locale ni allocation)
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value && !std::is_same<T, bool>::value>::type
+    append(T value) {
+        auto result = std::to_chars(text + length, text + LOG_LINE_CAPACITY, value);
+        if (result.ec == std::errc()) {
+            length = static_cast<uint16_t>(result.ptr - text);
+        }
+    }
+
+    // Enums (Side, OrderType, Action, OrderStatus, ...) : affichées via leur fonction toLabel()
+    template <typename T>
+    typename std::enable_if<std::is_enum<T>::value>::type
+    append(T value) {
+        append(toLabel(value));
+    }
+};
+
+// ###########################################################################################################
+// LOGGER ASYNCHRONE
+// ###########################################################################################################
+// Les threads qui loggent ne font que formater le message et le déposer dans un buffer circulaire
+// sans verrou (file MPSC bornée de D. Vyukov : plusieurs producteurs, un seul consommateur).
+// Un thread de fond vide le buffer et écrit sur la sortie (stdout par défaut) ; quand le buffer est vide,
+// il dort sur une variable de condition et n'est réveillé que par un dépôt (ou l'arrêt).
+// Si le buffer est plein, le message est perdu (et compté) : un thread de matching n'attend jamais la console.
+class Logger {
+public:
+    // Instance unique, créée (avec son thread d'écriture) au premier message
+    static Logger& instance();
+
+    // Formatage et dépôt d'un message (appelé via les macros LOG_*)
+    template <typename... Args>
+    void log(LogLevel level, const Args&... args) {
+        LogLine line;
+        line.level = level;
+        line.length = 0;
+        (line.append(args), ...);
+        push(line);
+    }
+
+    // Attente de l'écriture de tous les messages déjà déposés (ex : avant un affichage direct sur std::cout)
+    void flush();
+
+    // Changement de la sortie (fichier ouvert par l'appelant)
+    void setOutput(FILE* output);
+
+    // Nombre de messages perdus car le buffer était plein
+    uint64_t dropped() const { return dropped_count.load(std::memory_order_relaxed); }
+
+private:
+    Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // Arrêt du thread d'écriture après avoir vidé le buffer (appelé à la sortie du programme)
+    void shutdown();
+
+    void push(const LogLine& line);
+    void wakeWriter();
+    void run();
+    void write(const LogLine& line);
+
+    // Case du buffer : son numéro de séquence indique si elle est libre pour le producteur (== pos)
+    // ou prête pour le consommateur (== pos + 1)
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        LogLine line;
+    };
+
+    static constexpr size_t CAPACITY = 4096;  // puissance de 2
+    static constexpr size_t MASK = CAPACITY - 1;
+
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<uint64_t> enqueue_pos;
+    alignas(64) uint64_t dequeue_pos;           // uniquement utilisé par le thread d'écriture
+    std::atomic<uint64_t> written_count;        // nombre de messages écrits (pour flush())
+    std::atomic<uint64_t> dropped_count;
+    std::atomic<bool> running;
+    std::atomic<FILE*> output;
+    std::atomic<bool> sleeping;                 // le thread d'écriture attend sur wake (buffer vide)
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    std::thread worker;
+};
+
+// ###########################################################################################################
+// MACROS
+// ###########################################################################################################
+#if LOG_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) Logger::instance().log(LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(...) Logger::instance().log(LogLevel::INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(...) Logger::instance().log(LogLevel::WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) ((void)0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) Logger::instance().log(LogLevel::ERROR, __VA_ARGS__)
+#define LOG_FLUSH() Logger::instance().flush()
+#else
+#define LOG_ERROR(...) ((void)0)
+#define LOG_FLUSH() ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Fichier projeté en mémoire (mmap), en lecture seule, pour un parcours séquentiel.
+// data() vaut nullptr si le fichier est vide, introuvable ou ne peut pas être projeté.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+            void* mapping = ::mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                data_ = static_cast<const char*>(mapping);
+                size_ = static_cast<size_t>(file_stat.st_size);
+                // Lecture séquentielle : le noyau peut lire en avance de façon agressive
+                ::madvise(mapping, size_, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_;
+    size_t size_;
+};
+
+#endif
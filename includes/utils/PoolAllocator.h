@@ -0,0 +1,86 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Réserve de blocs de taille fixe (slab) : les blocs sont découpés dans de grands blocs mémoire ("slabs"),
+// et les blocs libérés sont chaînés dans une liste libre pour être réutilisés.
+// - allocation / libération : O(1), un simple dépilement / empilement dans la liste libre
+// - la mémoire n'est jamais rendue avant la destruction de la réserve : en régime établi, aucun malloc / free
+// - la taille des blocs est fixée par la première allocation (celle des noeuds du conteneur qui l'utilise)
+class SlabPool {
+public:
+    // reserved_blocks blocs sont préparés dès la première allocation
+    explicit SlabPool(size_t reserved_blocks = 0);
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    // Bloc d'au moins size octets (size doit être la taille des blocs, sinon allocation classique)
+    void* allocate(size_t size);
+    void deallocate(void* block, size_t size);
+
+    // Nombre de blocs découpés au total et nombre de blocs en cours d'utilisation
+    size_t capacity() const { return block_count; }
+    size_t used() const { return used_count; }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // Ajout d'un slab de count blocs à la liste libre
+    void addSlab(size_t count);
+
+    size_t reserved_blocks;
+    size_t block_size;
+    size_t block_count;
+    size_t used_count;
+    FreeBlock* free_list;
+    std::vector<std::unique_ptr<unsigned char[]>> slabs;
+};
+
+// Allocateur standard qui prend ses blocs dans une SlabPool (ex : noeuds d'une std::map).
+// Les conteneurs à noeuds n'allouent qu'un noeud à la fois : toutes les allocations d'un seul élément
+// passent par la réserve, les autres (rares) par l'allocateur classique.
+// La réserve n'appartient pas à l'allocateur : elle doit survivre au conteneur.
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(SlabPool* pool) : pool(pool) {}
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : pool(other.pool) {}
+
+    T* allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<T*>(pool->allocate(sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) {
+        if (n == 1) {
+            pool->deallocate(pointer, sizeof(T));
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const { return pool == other.pool; }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const { return pool != other.pool; }
+
+private:
+    template <typename U>
+    friend class PoolAllocator;
+
+    SlabPool* pool;
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+// File circulaire bornée sans verrou, pour exactement un thread producteur et un thread consommateur.
+// - le producteur n'écrit que tail, le consommateur n'écrit que head (chacun sur sa propre ligne de cache)
+// - chaque côté garde une copie locale de l'index de l'autre et ne relit l'atomique que si la file
+//   semble pleine (producteur) ou vide (consommateur) : pas d'échange de ligne de cache à chaque opération
+// - la capacité est arrondie à la puissance de 2 supérieure
+// Attente d'une file pleine ou vide : attente active courte, puis on cède le coeur
+// (un thread qui attend ne doit pas monopoliser un coeur partagé avec celui qu'il attend)
+inline void waitBackoff(unsigned& idle_rounds) {
+    if (++idle_rounds < 64) {
+        return;
+    }
+    std::this_thread::yield();
+}
+
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t min_capacity) : head(0), cached_tail(0), tail(0), cached_head(0) {
+        size_t capacity = 2;
+        while (capacity < min_capacity) {
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        slots.reset(new T[capacity]);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Dépôt d'un élément (producteur), false si la file est pleine
+    template <typename U>
+    bool tryPush(U&& value) {
+        size_t current_tail = tail.load(std::memory_order_relaxed);
+        if (current_tail - cached_head > mask) {
+            cached_head = head.load(std::memory_order_acquire);
+            if (current_tail - cached_head > mask) {
+                return false;
+            }
+        }
+        slots[current_tail & mask] = std::forward<U>(value);
+        tail.store(current_tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Retrait d'un élément (consommateur), false si la file est vide
+    bool tryPop(T& value) {
+        size_t current_head = head.load(std::memory_order_relaxed);
+        if (current_head == cached_tail) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (current_head == cached_tail) {
+                return false;
+            }
+        }
+        value = std::move(slots[current_head & mask]);
+        head.store(current_head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // File vide (valeur indicative si l'autre côté travaille en même temps)
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return mask + 1; }
+
+private:
+    std::unique_ptr<T[]> slots;
+    size_t mask;
+
+    // Côté consommateur
+    alignas(64) std::atomic<size_t> head;
+    size_t cached_tail;
+
+    // Côté producteur
+    alignas(64) std::atomic<size_t> tail;
+    size_t cached_head;
+};
+
+#endif
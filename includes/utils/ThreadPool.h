@@ -0,0 +1,71 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de threads avec vol de tâches (work stealing).
+// Chaque worker a sa propre file de tâches : il prend ses tâches par l'avant (dans l'ordre de soumission)
+// et, quand sa file est vide, il vole les tâches des autres workers par l'arrière.
+// Si les tâches sont soumises de la plus lourde à la plus légère, chaque worker commence donc par une tâche
+// lourde, et les workers libres récupèrent les tâches légères restantes pendant que les lourdes s'exécutent.
+class ThreadPool {
+public:
+    // Constructeur (0 = nombre de coeurs de la machine)
+    explicit ThreadPool(size_t thread_count = 0);
+
+    // Destructeur : attend la fin des tâches soumises puis arrête les threads
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Soumission d'une tâche (répartie à tour de rôle sur les files des workers)
+    void submit(std::function<void()> task);
+
+    // Attente de la fin de toutes les tâches soumises.
+    // Si une tâche a levé une exception, la première est relancée ici.
+    void wait();
+
+    // Nombre de threads du pool
+    size_t size() const { return workers.size(); }
+
+private:
+    // File de tâches d'un worker (protégée par son propre mutex : peu de contention,
+    // les autres workers n'y accèdent que pour voler)
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void run(size_t index);
+    bool popLocal(size_t index, std::function<void()>& task);
+    bool steal(size_t index, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> next_queue;
+
+    // Sommeil des workers quand il n'y a plus rien à prendre
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_cv;
+    std::atomic<int64_t> queued_count;  // tâches dans les files (signé : brièvement négatif si une tâche est prise avant d'être comptée)
+    bool stopping;
+
+    // Attente de la fin des tâches
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    size_t pending_count;                // tâches soumises et pas encore terminées
+    std::exception_ptr first_error;
+};
+
+#endif
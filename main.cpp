@@ -1,51 +1,90 @@
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
-#include <map>
+#include <memory>
+#include <string>
 #include <vector>
 #include "includes/data/CSVReader.h"
 #include "includes/data/CSVWriter.h"
+#include "includes/data/ResultLog.h"
 #include "includes/core/MatchingEngine.h"
+#include "includes/core/Pipeline.h"
+#include "includes/utils/ThreadPool.h"
+
+// Utilisation : ./order_book [fichier d'input] [nombre de threads | pipeline] [csv | binary]
+// (par défaut : Inputs/input_with_market_orders.csv, un thread par coeur, sortie csv)
+int main(int argc, char** argv) {
+    std::string input_file = (argc > 1) ? argv[1] : "Inputs/input_with_market_orders.csv";
+    std::string mode = (argc > 2) ? argv[2] : "";
+    size_t thread_count = std::strtoul(mode.c_str(), nullptr, 10);
+    bool binary_output = (argc > 3) && std::string(argv[3]) == "binary";
+
+    // Nom des fichiers de sortie : "input_xxx.csv" -> "Outputs/output_xxx <actif>.csv"
+    std::string base_name = input_file.substr(input_file.find_last_of('/') + 1);
+    base_name = base_name.substr(0, base_name.find_last_of('.'));
+    std::string output_prefix = (base_name.rfind("input", 0) == 0) ? "output" + base_name.substr(5) : "output_" + base_name;
+
+    // Mode pipeline : lecture, validation, matching, formatage et écriture en parallèle, lot par lot
+    // (le fichier n'est jamais chargé en entier, les résultats ne sont pas affichés)
+    if (mode == "pipeline") {
+        Pipeline pipeline(input_file, "Outputs/" + output_prefix + " ");
+        const PipelineStats& stats = pipeline.run();
+        if (stats.failed_files > 0) {
+            std::cerr << "Echec de l'écriture de " << stats.failed_files << " fichier(s) de sortie" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
 
-int main() {
     // Chargement des ordres
-    CsvReader csvReader("Inputs/input_with_market_orders.csv");
+    CsvReader csvReader(input_file);
     csvReader.init();
     csvReader.Display();
-    
-    // Récupération du mapping
-    std::map<std::string, std::vector<Order>> map_asset_orders = csvReader.getMapOrder();
 
-    // Boucle sur chaque actif
-    for(auto i:map_asset_orders){
+    // Récupération du mapping (une vue par actif sur les ordres chargés, indexée par ID : aucun ordre n'est copié)
+    std::vector<std::pair<Instrument, OrderView>> assets = csvReader.getInstrumentViews();
 
-        // Récupération du nom de l'actif
-        std::string asset_name = i.first;
-
-        // Récupération du vecteur d'ordres
-        std::vector<Order> asset_order_vector = i.second;
+    // Un matching engine par actif (tableau plat indexé par ID d'instrument), conservé pour l'affichage des
+    // résultats à la fin. L'affichage se fait par ordre alphabétique des actifs.
+    std::vector<std::unique_ptr<MatchingEngine>> engines(SymbolTable::size());
+    std::vector<std::pair<std::string, MatchingEngine*>> engines_by_name;
+    for (const auto& asset : assets) {
+        engines[asset.first.id] = std::make_unique<MatchingEngine>();
+        engines_by_name.emplace_back(asset.first.name(), engines[asset.first.id].get());
+    }
+    std::sort(engines_by_name.begin(), engines_by_name.end());
 
-        // Initialisation du matching engine
-        MatchingEngine engine;
-        engine.processAllOrders(asset_order_vector);
+    // Les actifs n'ont aucun état en commun : chaque actif (matching + écriture du csv) est une tâche du pool.
+    // On soumet les actifs du plus gros au plus petit, pour que les plus lourds démarrent en premier et que
+    // les threads libres se partagent les petits pendant ce temps.
+    std::stable_sort(assets.begin(), assets.end(), [](const auto& a, const auto& b) {
+        return a.second.size() > b.second.size();
+    });
 
-        // Affichage des résultats
-        engine.displayResults();
+    ThreadPool pool(thread_count);
+    for (const auto& asset : assets) {
+        MatchingEngine* engine = engines[asset.first.id].get();
+        const std::string& asset_name = asset.first.name();
+        const OrderView& asset_orders = asset.second;
+        pool.submit([engine, &asset_name, &asset_orders, &output_prefix, binary_output]() {
+            engine->processAllOrders(asset_orders);
 
-        // Savegarde en csv
-        CsvWriter csvWriter_test("Outputs/output_with_market_orders " + asset_name + ".csv");
-        std::vector<OrderResult> trade_historic = engine.getTradeHistoric();
-        csvWriter_test.WriteToCsv(trade_historic);
+            // Savegarde en csv (ou en journal binaire, converti en csv par build/tools/result_log_to_csv)
+            if (binary_output) {
+                ResultLogWriter resultLogWriter("Outputs/" + output_prefix + " " + asset_name + ".bin");
+                resultLogWriter.WriteToBinary(engine->getResults());
+            } else {
+                CsvWriter csvWriter_test("Outputs/" + output_prefix + " " + asset_name + ".csv");
+                csvWriter_test.WriteToCsv(engine->getResults());
+            }
+        });
     }
+    pool.wait();
 
-    // Matching Engine
-    // MatchingEngine engine;
-    // engine.processAllOrders(csvReader.getOrders());
-
-    // Affichage des résultats
-    // engine.displayResults();
+    // Affichage des résultats, actif par actif (une fois tous les threads terminés)
+    for (const auto& [asset_name, engine] : engines_by_name) {
+        engine->displayResults();
+    }
 
-    // Sauvegarde en csv
-    // CsvWriter csvWriter("output.csv");
-    // csvWriter.WriteToCsv(engine.historic_trades);
-    
     return 0;
-}
\ No newline at end of file
+}
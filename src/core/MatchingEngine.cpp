@@ -1,15 +1,25 @@
 #include "core/MatchingEngine.h"
+#include "utils/Logger.h"
 #include <algorithm>
 #include <chrono>
  
-// Constructeur
-MatchingEngine::MatchingEngine() : current_timestamp(0) {
-    std::cout << "Initialisation du Matching Engine" << std::endl;
+// Constructeurs
+MatchingEngine::MatchingEngine() : MatchingEngine(EngineConfig()) {}
+
+MatchingEngine::MatchingEngine(const EngineConfig& config)
+    : book(config.order_capacity, config.level_capacity), current_timestamp(0), output(&historic_trades),
+      listener(nullptr), keep_history(config.keep_history) {
+    book.setTrackDeltas(config.track_depth);
+    order_index.reserve(config.order_capacity);
+    trade_buffer.reserve(MATCH_BUFFER_CAPACITY);
+    pending_impacted_orders.reserve(MATCH_BUFFER_CAPACITY);
+    historic_trades.reserve(config.result_capacity);
+    LOG_DEBUG("Initialisation du Matching Engine");
 }
  
 // Destructeur
 MatchingEngine::~MatchingEngine() {
-    std::cout << "Destruction du Matching Engine" << std::endl;
+    LOG_DEBUG("Destruction du Matching Engine");
 }
  
 //######################################################################################################################################################
@@ -20,92 +30,165 @@ MatchingEngine::~MatchingEngine() {
 //      ou on regarde dans la bonne partie du book pour modifier / retirer l'ordre
 //  - chaque action est répertoriée dans un vecteur, qui sera l'output (historique des actions)
 // tandis que l'order book est modifié dynamiquement (retrait des ordres exécutés ou annulés, changement de temporalité en cas de modification,...)
-// Notons que les book SELL et BUY sont des objets "priority_queue" et sont donc classés dans l'ordre décroissant du prix pour BUY et croissant pour SELL,
-//      puis selon la règle FIFO
+// Notons que les book SELL et BUY sont organisés par niveaux de prix (décroissants pour BUY, croissants pour SELL),
+//      chaque niveau étant une file FIFO
 //######################################################################################################################################################
  
-std::vector<OrderResult> MatchingEngine::processAllOrders(const std::vector<Order>& orders) {
+ResultView MatchingEngine::processAllOrders(const std::vector<Order>& orders) {
+    return processAllOrders(OrderView(orders));
+}
+ 
+ResultView MatchingEngine::processAllOrders(const OrderView& orders) {
     // ################################################################################################
     // Cette fonction permet de traiter séquentiellement tous les ordres (en bouclant)
-    // Elle prend en input le vecteur contenant les ordres (après passage par le CSVReader)
+    // Elle prend en input une vue sur les ordres (après passage par le CSVReader) : les ordres ne sont pas copiés
     // Elle renvoie l'historique des trades / actions
     // On fait aussi un contrôle du tri par timestamp avant traitement
     // ################################################################################################
  
-    std::cout << "\n=== DÉBUT DU MATCHING ENGINE ===" << std::endl;
-    std::cout << "Nombre d'ordres à traiter : " << orders.size() << std::endl;
-    
+    LOG_INFO("=== DÉBUT DU MATCHING ENGINE === Nombre d'ordres à traiter : ", orders.size());
+    if (keep_history) {
+        historic_trades.reserve(historic_trades.size() + orders.size());
+    }
+    std::vector<uint32_t> sorted_positions;
+    bool is_sorted = chronologicalOrder(orders, sorted_positions);
+ 
     // ################################################################################################
-    // On contrôle si le vecteur passé en input est bien trié par timestamp
+    // TRAITEMENT DES ORDRES
     // ################################################################################################
-    // Création d'une copie du vecteur d'ordres
-    std::vector<Order> sorted_orders = orders;
+    
+    // Boucle sur les ordres dans l'ordre chronologique (on itère tant qu'on n'est pas à la fin de la liste)
+    for (size_t i = 0; i < orders.size(); i++) {
  
-    // Vérification que les ordres sont tries par date (timestamp)
+        // On récupère le nouvel ordre (référence, sans copie) et on le traite
+        processOrder(is_sorted ? orders[i] : orders[sorted_positions[i]]);
+    }
+ 
+    LOG_INFO("=== FIN DU MATCHING ENGINE === Résultats générés : ", historic_trades.size());
+ 
+    return historic_trades.view();
+}
+
+bool MatchingEngine::chronologicalOrder(const OrderView& orders, std::vector<uint32_t>& sorted_positions) const {
+    // ################################################################################################
+    // On contrôle si les ordres passés en input sont bien triés par timestamp
+    // ################################################################################################
     bool is_sorted = true;
-    for (size_t i = 1; i < sorted_orders.size(); i++) {
-        if (sorted_orders[i].timestamp < sorted_orders[i-1].timestamp) {
+    for (size_t i = 1; i < orders.size(); i++) {
+        if (orders[i].timestamp < orders[i-1].timestamp) {
             is_sorted = false;
             break;
         }
     }
     
-    // Si les ordres ne sont pas dans l'ordre chronologies, ils sont triés
+    // Si les ordres ne sont pas dans l'ordre chronologique, on trie leurs positions (et non les ordres eux-mêmes)
     if (!is_sorted) {
-        std::cout << "Les ordres ne sont pas triés par timestamp. On trie automatiquement" << std::endl;
-        std::sort(sorted_orders.begin(), sorted_orders.end(),
-                  [](const Order& a, const Order& b) {
-                      return a.timestamp < b.timestamp;
+        LOG_INFO("Les ordres ne sont pas triés par timestamp. On trie automatiquement");
+        sorted_positions.resize(orders.size());
+        for (size_t i = 0; i < orders.size(); i++) {
+            sorted_positions[i] = static_cast<uint32_t>(i);
+        }
+        std::sort(sorted_positions.begin(), sorted_positions.end(),
+                  [&orders](uint32_t a, uint32_t b) {
+                      return orders[a].timestamp < orders[b].timestamp;
                   });
     }
+    return is_sorted;
+}
+ 
+// Traitement d'un ordre, puis transmission de ses résultats à l'abonné enregistré (s'il y en a un)
+void MatchingEngine::processOrder(const Order& current_order) {
+    size_t first = historic_trades.size();
+    matchOrder(current_order);
+    finishOrder(first);
+}
+
+void MatchingEngine::finishOrder(size_t first) {
+    if (listener != nullptr) {
+        publish(historic_trades, first, *listener);
+    }
+    if (!keep_history) {
+        historic_trades.clear();
+    }
+}
+
+// Entrée par span : ni contrôle du tri, ni copie des ordres. Les résultats sont écrits directement dans
+// la table de l'appelant (output), et recopiés dans l'historique seulement s'il est conservé.
+size_t MatchingEngine::processOrders(const OrderView& orders, ResultTable& out) {
+    size_t out_first = out.size();
+
+    // Les résultats vont dans la table de l'appelant pendant l'appel, puis de nouveau dans l'historique
+    // en sortie (même si un abonné lève une exception : l'engine ne doit pas garder un pointeur sur out)
+    struct OutputGuard {
+        ResultTable*& output;
+        ResultTable* history;
+        ~OutputGuard() { output = history; }
+    } guard{output, &historic_trades};
+    output = &out;
+    for (size_t i = 0; i < orders.size(); i++) {
+        size_t first = out.size();
+        matchOrder(orders[i]);
+        if (listener != nullptr) {
+            publish(out, first, *listener);
+        }
+        if (keep_history) {
+            for (size_t row = first; row < out.size(); row++) {
+                historic_trades.append(out[row]);
+            }
+        }
+    }
+    return out.size() - out_first;
+}
  
+void MatchingEngine::matchOrder(const Order& current_order) {
     // ################################################################################################
-    // TRAITEMENT DES ORDRES
+    // Traitement d'un ordre individuel, dans l'ordre d'arrivée (utilisé par processAllOrders et par le
+    // mode continu, où les ordres arrivent un par un). Les résultats sont ajoutés à la table output
+    // (l'historique, ou la table de l'appelant pour processOrders).
     // ################################################################################################
     
-    // Boucle sur la liste triée (on itère tant qu'on n'est pas à la fin de la liste)
-    for (size_t i = 0; i < sorted_orders.size(); i++) {
+    // ################################################################################################
+    // VÉRIFICATION BAD_INPUT
+    // ################################################################################################
  
-        // On récupère le nouvel ordre depuis le vecteur trié
-        Order current_order = sorted_orders[i];
-        
-        // ################################################################################################
-        // VÉRIFICATION BAD_INPUT
-        // ################################################################################################
- 
-        // Si un ordre est estampillé "BAD_INPUT", il est rejeté automatiquement et on passe à l'ordre suivant
-        if (current_order.type == "BAD_INPUT") {
-            std::cout << "ERREUR: Type BAD_INPUT détecté pour l'ordre ID " << current_order.order_id << " - Ordre rejeté immédiatement" << std::endl;
-            OrderResult result = createResult(current_order, "REJECTED");
-            historic_trades.push_back(result);
-            continue;   
-        }
+    // Les variations de niveaux (L2) ne concernent que l'ordre en cours
+    book.clearDeltas();
+
+    // Si un ordre est estampillé "BAD_INPUT", il est rejeté automatiquement
+    if (current_order.type == OrderType::BAD_INPUT) {
+        LOG_WARN("Type BAD_INPUT détecté pour l'ordre ID ", current_order.order_id, " - Ordre rejeté immédiatement");
+        output->append(current_order, OrderStatus::REJECTED);
+        return;
+    }
  
-        // On distingue selon l'action de l'ordre
-        if (current_order.action == "NEW") {
+    // On distingue selon l'action de l'ordre
+    switch (current_order.action) {
+        case Action::NEW:
             handleNew(current_order);
-        } else if (current_order.action == "MODIFY") {
+            break;
+        case Action::MODIFY:
             handleModify(current_order);
-        } else if (current_order.action == "CANCEL") {
+            break;
+        case Action::CANCEL:
             handleCancel(current_order);
-        } else {
+            break;
+        default: {
             // Si action inconnue -> on ne fait pas planter le matching engine mais on rejette l'ordre
-            std::cout << "Action inconnue : " << current_order.action << std::endl;
-            OrderResult result = createResult(current_order, "REJECTED");
-            historic_trades.push_back(result);
+            LOG_WARN("Action inconnue : ", current_order.action);
+            output->append(current_order, OrderStatus::REJECTED);
+            break;
         }
     }
- 
-    std::cout << "\n=== FIN DU MATCHING ENGINE ===" << std::endl;
-    std::cout << "Résultats générés : " << historic_trades.size() << std::endl;
- 
-    return historic_trades;
 }
  
- 
 void MatchingEngine::handleNew(const Order& order) {
+    // Un ordre NEW démarre avec un état de suivi vierge : sa quantité d'origine est celle de l'ordre
+    handleNew(order, OrderState{order.quantity, 0, OrderStatus::PENDING});
+}
+ 
+void MatchingEngine::handleNew(const Order& order, OrderState state) {
     // ################################################################################################
-    // Fonction qui gère l'action NEW
+    // Fonction qui gère l'action NEW (et la réinsertion d'un ordre modifié, avec son état de suivi)
     // Concrètement, on récupère l'ordre et on regarde s'il peut être matché avec un / des ordres opposés,
     // Pour chaque match individuel, on génère une ligne dans l'historique
     // Puis si besoin, on ajoute l'ordre (avec quantité et état mis à jour) dans les books BUY et SELL.
@@ -115,41 +198,46 @@ void MatchingEngine::handleNew(const Order& order) {
     // ################################################################################################
     // On contrôle que l'ID n'existe pas déjà
     // ################################################################################################
-    auto existing_order = order_map.find(order.order_id);
-    if (existing_order != order_map.end()) {
-        std::cout << "ERREUR: ID " << order.order_id << " existe déjà pour un ordre NEW !" << std::endl;
-        std::cout << "Ordre existant : Side = " << existing_order->second.side
-                  << ", Quantité = " << existing_order->second.quantity
-                  << ", Prix = " << existing_order->second.price << std::endl;
-        OrderResult result = createResult(order, "REJECTED");
-        historic_trades.push_back(result);
+    OrderHandle existing_handle = order_index.find(order.order_id);
+    if (existing_handle != NULL_HANDLE) {
+        LOG_WARN("ID ", order.order_id, " existe déjà pour un ordre NEW ! Ordre existant : Side = ",
+                 book.get(existing_handle).side, ", Quantité = ", book.get(existing_handle).quantity,
+                 ", Prix = ", book.get(existing_handle).price);
+        output->append(order, OrderStatus::REJECTED);
         return;
     }
  
+    // Chemin rapide : un ordre LIMIT qui ne croise pas le meilleur prix opposé (en cache dans le carnet)
+    // ne peut rien exécuter, il va directement au carnet sans passer par tryMatch
+    if (order.type == OrderType::LIMIT && !book.crosses(order.side, order.price)) {
+        LOG_DEBUG("Aucun croisement avec le meilleur prix opposé - Ajout au carnet");
+        state.last_status = OrderStatus::PENDING;
+        addToBook(order, state);
+        output->append(order, OrderStatus::PENDING);
+        return;
+    }
+
     // Si l'existe n'existe pas, on ajoute l'ordre au book et on effectue l'algorithme de matching
-    // 1. MATCHING
-    Order working_order = order;  // Copie pour modification des quantités
-    std::vector<Trade> matches = tryMatch(working_order);
+    // 1. MATCHING (les trades sont dans un buffer réutilisé, aucune copie de l'ordre n'est nécessaire)
+    const std::vector<Trade>& matches = tryMatch(order);
     
     // 1.1. Si pas de match :
     if (matches.empty()) {
         // Si c'est un ordre au marché, on le rejette
-        if (order.type == "MARKET") {
-            std::cout << "MARKET order rejeté (Carnet opposé vide)" << std::endl;
+        if (order.type == OrderType::MARKET) {
+            LOG_DEBUG("MARKET order rejeté (Carnet opposé vide)");
             
             // Akout du rejet de l'ordre dans les fichiers de résultats
-            OrderResult result = createResult(order, "REJECTED");
-            historic_trades.push_back(result);    
+            output->append(order, OrderStatus::REJECTED);
         }
         // Si c'est un ordre à cours limité, on l'ajoute sur le carnet
         else {
-            std::cout << "Aucun match trouvé - Ajout au carnet" << std::endl;
-            addToBook(order);
-            order_map[order.order_id] = order;
+            LOG_DEBUG("Aucun match trouvé - Ajout au carnet");
+            state.last_status = OrderStatus::PENDING;
+            addToBook(order, state);
             
             // Ajout de l'ordre dans les fichiers de résultats
-            OrderResult result = createResult(order, "PENDING");
-            historic_trades.push_back(result);
+            output->append(order, OrderStatus::PENDING);
         }
     
     // 1.2. Si match :
@@ -163,47 +251,46 @@ void MatchingEngine::handleNew(const Order& order) {
             remaining_order_qty -= trade.quantity;
             
             // Récupération de l'ID de la contrepartie
-            int counterparty_id = (order.side == "BUY") ? trade.sell_order_id : trade.buy_order_id;
+            int counterparty_id = (order.side == Side::BUY) ? trade.sell_order_id : trade.buy_order_id;
             
             // On détermine le status de l'ordre selon les quantités restantes à exécuter
-            std::string status;
+            OrderStatus status;
             if (i == matches.size() - 1) {  // Dernier match
                 if (remaining_order_qty == 0) {
-                    status = "EXECUTED";  
+                    status = OrderStatus::EXECUTED;  
                 } else {
-                    status = "PARTIALLY_EXECUTED";  
+                    status = OrderStatus::PARTIALLY_EXECUTED;  
                 }
             } else {
-                status = "PARTIALLY_EXECUTED";  // Pas le dernier match, donc forcément partiel
+                status = OrderStatus::PARTIALLY_EXECUTED;  // Pas le dernier match, donc forcément partiel
             }
             
             // Dans les résultats on aura une ligne par trade
             Order match_order = order;
-            if (status == "EXECUTED") {
+            if (status == OrderStatus::EXECUTED) {
                 match_order.quantity = 0;  
             } else {
                 match_order.quantity = remaining_order_qty;  
             }
             
             // Récupération dans l'historique
-            OrderResult result = createResult(match_order, status, trade.quantity, trade.price, counterparty_id);
-            historic_trades.push_back(result);
+            output->append(match_order, status, trade.quantity, trade.price, counterparty_id);
         }
         
         // Si l'ordre n'est pas complètement exécuté et que c'est un ordre limite, on ajoute le résidu au carnet
-        if (remaining_order_qty > 0 && order.type == "LIMIT") {
-            std::cout << "Résidu de " << remaining_order_qty << " ajouté au carnet" << std::endl;
+        if (remaining_order_qty > 0 && order.type == OrderType::LIMIT) {
+            LOG_DEBUG("Résidu de ", remaining_order_qty, " ajouté au carnet");
             Order residual_order = order;
             residual_order.quantity = remaining_order_qty;
-            addToBook(residual_order);
-            order_map[order.order_id] = residual_order;
+            state.filled_quantity += order.quantity - remaining_order_qty;
+            state.last_status = OrderStatus::PARTIALLY_EXECUTED;
+            addToBook(residual_order, state);
         }
         
         // Mise à jour de l'historique pour les ordres restant dans le carnet impacté par la transaction
         for (const OrderResult& impacted : pending_impacted_orders) {
-            historic_trades.push_back(impacted);
+            output->append(impacted);
         }
-        pending_impacted_orders.clear();  
     }
 }
  
@@ -219,116 +306,73 @@ void MatchingEngine::handleModify(const Order& order) {
     // ################################################################################################
  
     // Recherhce de l'ID (si pas présent -> marqueur après le dernier élément (donc vide))
-    auto it = order_map.find(order.order_id);
+    OrderHandle handle = order_index.find(order.order_id);
  
     // 1. Cas où l'ordre à modifier n'est pas dans le carnet
-    if (it == order_map.end()) {
+    if (handle == NULL_HANDLE) {
         // Message d'erreur pour informer l'utilisateur
-        std::cout << "ERREUR: Ordre ID " << order.order_id << " non trouvé pour modification" << std::endl;
+        LOG_WARN("Ordre ID ", order.order_id, " non trouvé pour modification");
         // Rejet de l'ordre (pas valide) --> on ne fait pas planter le code mais on rejette
-        OrderResult result = createResult(order, "REJECTED");
-        historic_trades.push_back(result);
+        output->append(order, OrderStatus::REJECTED);
         return;
     }
     
-    // 2. Si l'ordre est dans le carnet, on récupère la quantité initiale
-    int initial_quantity = -1;
-    for (const OrderResult& result : historic_trades) {
-        if (result.original_order.order_id == order.order_id && result.original_order.action == "NEW") {
-            // Pour récupérer la quantité initiale, on doit regarder :
-            // - Si PENDING : la quantité affichée est la quantité initiale
-            // - Si EXECUTED/PARTIALLY_EXECUTED : quantité affichée + quantité exécutée = quantité initiale
-            if (result.status == "PENDING") {
-                initial_quantity = result.original_order.quantity;
-            } else if (result.status == "EXECUTED") {
-                initial_quantity = result.original_order.quantity + result.executed_quantity;
-            } else if (result.status == "PARTIALLY_EXECUTED") {
-                initial_quantity = result.original_order.quantity + result.executed_quantity;
-            }
-            break;
-        }
-    }
-    
-    // Si la quantité initiale est toujours à -1, il y'a eu un problème dans l'exécution
-    if (initial_quantity == -1) {
-        std::cout << "ERREUR: Impossible de trouver la quantité initiale pour l'ordre ID " << order.order_id << std::endl;
-        OrderResult result = createResult(order, "REJECTED");
-        historic_trades.push_back(result);
-        return;
-    }
+    // 2. Si l'ordre est dans le carnet, on récupère la quantité initiale (celle de l'ordre NEW d'origine),
+    // conservée dans l'état de suivi de l'ordre : pas besoin de relire l'historique (O(1))
+    OrderState state = book.state(handle);
+    int initial_quantity = state.original_quantity;
     
     // 3. Calcul de la nouvelle quantité
     // Concrètement, nouvelle quantité = qté_restante - (qté_initiale - qté_modifiée)
     // Donc si qté_initiale = 100, qté_restante = 50 et qté_modifiée = 70, qté_new = 20
     // Si qté_initiale = 100, qté_restante = 50 et qté_modifiée = 130, qté_new = 80
     // Si qté_initiale = 100, qté_restante = 50 et qté_modifiée = 40, qté_new = 0
-    int current_quantity = it->second.quantity;
+    const Order& resting_order = book.get(handle);
+    int current_quantity = resting_order.quantity;
+    Price resting_price = resting_order.price;
     int reduction = initial_quantity - order.quantity;  
     int new_quantity = current_quantity - reduction;    
     
     // 4. Gestion des cas limites
     if (new_quantity <= 0) {
-        std::cout << "MODIFY résulte en quantité <= 0 - Ordre considéré comme complètement exécuté" << std::endl;
+        LOG_DEBUG("MODIFY résulte en quantité <= 0 - Ordre considéré comme complètement exécuté");
         
-        // On supprime l'ordre du carnet
-        bool removed = removeFromBook(order.order_id, it->second.side);
+        // On supprime l'ordre du carnet (et de l'index)
+        bool removed = removeFromBook(order.order_id);
         if (removed) {
             // On crée un résultat EXECUTED avec la quantité restante comme quantité exécutée
             Order executed_order = order;
             executed_order.quantity = 0;
             
-            OrderResult result = createResult(executed_order, "EXECUTED", current_quantity, it->second.price, 0);
-            historic_trades.push_back(result);
-            
-            // Suppression de la map
-            order_map.erase(it);
+            output->append(executed_order, OrderStatus::EXECUTED, current_quantity, resting_price, 0);
         } else {
-            std::cout << "ERREUR: Impossible de supprimer l'ordre du carnet" << std::endl;
-            OrderResult result = createResult(order, "REJECTED");
-            historic_trades.push_back(result);
+            LOG_ERROR("Impossible de supprimer l'ordre ", order.order_id, " du carnet");
+            output->append(order, OrderStatus::REJECTED);
         }
         return;
     }
     
     // 5. Ordre trouvé avec quantité valide
-    std::cout << "Ordre trouvé - Suppression du carnet et retraitement avec nouvelle quantité: " << new_quantity << std::endl;
+    LOG_DEBUG("Ordre trouvé - Suppression du carnet et retraitement avec nouvelle quantité: ", new_quantity);
     
-    // On supprime l'ancien ordre du carnet
-    bool removed = removeFromBook(order.order_id, it->second.side);
+    // On supprime l'ancien ordre du carnet (et de l'index)
+    bool removed = removeFromBook(order.order_id);
     
     // Si pour une raison X ou Y on ne peut pas le supprimer -> rejet de l'ordre (ne devrait pas se produire)
     if (!removed) {
-        std::cout << "ERREUR: Impossible de supprimer l'ordre du carnet" << std::endl;
-        OrderResult result = createResult(order, "REJECTED");
-        historic_trades.push_back(result);
+        LOG_ERROR("Impossible de supprimer l'ordre ", order.order_id, " du carnet");
+        output->append(order, OrderStatus::REJECTED);
         return;
     }
     
     // On récupère les caractéristiques nouvelles
     Order modified_order = order;
     modified_order.quantity = new_quantity;      
-    // On supprime de la map l'ancien ordre
-    order_map.erase(it);
-    
-    // On traite l'ordre comme un nouvel ordre, tout en écrivant toutes les informations dans l'historique.
-    size_t historic_size_before = historic_trades.size();
-    handleNew(modified_order);
     
-    // Si des résultats ont été ajoutés par handleNew, on modifie l'ordre entrant dans l'historique
-    if (historic_trades.size() > historic_size_before) {
-        // Le premier résultat ajouté est celui de l'ordre modifié
-        OrderResult& modify_result = historic_trades[historic_size_before];
-        
-        // On corrige l'action pour afficher MODIFY au lieu de NEW
-        modify_result.original_order.action = "MODIFY";
-        modify_result.original_order.timestamp = order.timestamp;  // On garde le timestamp original du MODIFY ici
-        
-        // Si complètement exécuté, la quantité affichée doit être 0
-        if (modify_result.status == "EXECUTED") {
-            modify_result.original_order.quantity = 0;
-        } else if (modify_result.status == "PARTIALLY_EXECUTED") {
-        }
-    }
+    // On traite l'ordre comme un nouvel ordre (avec son état de suivi), tout en écrivant toutes les informations dans l'historique.
+    // L'ordre garde l'action MODIFY et le timestamp du MODIFY : les lignes ajoutées à l'historique sont donc
+    // directement correctes, l'historique n'est jamais relu.
+    handleNew(modified_order, state);
 }
  
 // CANCEL : Fonctionnement similaire à MODIFY mais on efface directement du book.
@@ -342,269 +386,270 @@ void MatchingEngine::handleCancel(const Order& order) {
         
     // Toute la logique est la même que pour MODIFY. Elle est même ici plus simple car il faut juste
     //      supprimer l'ordre du book et enregistrer dans l'historique.
-    auto it = order_map.find(order.order_id);
-    if (it == order_map.end()) {
-        std::cout << "ERREUR: Ordre ID " << order.order_id << " non trouvé pour annulation" << std::endl;
-        OrderResult result = createResult(order, "REJECTED");
-        historic_trades.push_back(result);
+    if (order_index.find(order.order_id) == NULL_HANDLE) {
+        LOG_WARN("Ordre ID ", order.order_id, " non trouvé pour annulation");
+        output->append(order, OrderStatus::REJECTED);
         return;
     }
         
-    // On supprime la ligne du book. On garde la condition pour potentielle erreur, mais ça ne devrait pas arriver.
-    bool removed = removeFromBook(order.order_id, it->second.side);
+    // On supprime la ligne du book (et de l'index). On garde la condition pour potentielle erreur, mais ça ne devrait pas arriver.
+    bool removed = removeFromBook(order.order_id);
     if (removed) {        
         // Quantité : 0 (ordre supprimé)
         Order canceled_order = order;
         canceled_order.quantity = 0;
     
-        OrderResult result = createResult(canceled_order, "CANCELED");
-        historic_trades.push_back(result);
-        
-        // Suppression de la map
-        order_map.erase(it);
+        output->append(canceled_order, OrderStatus::CANCELED);
     } else {
-        std::cout << "ERREUR: Impossible de supprimer l'ordre du carnet" << std::endl;
-        OrderResult result = createResult(order, "REJECTED");
-        historic_trades.push_back(result);
+        LOG_ERROR("Impossible de supprimer l'ordre ", order.order_id, " du carnet");
+        output->append(order, OrderStatus::REJECTED);
     }
 }
  
 // Procédure de matching, coeur du code
-std::vector<Trade> MatchingEngine::tryMatch(Order& incoming_order) {
+const std::vector<Trade>& MatchingEngine::tryMatch(const Order& incoming_order) {
     // ################################################################################################
     // Fonction qui gère le matching.
     // Concrètement, on récupère l'ordre et on regarde s'il peut être matché à des ordres adverses, en respectant
     // la règle du FIFO.
+    // On parcourt le carnet opposé à partir de son meilleur ordre (tête de file du meilleur niveau de prix) :
+    // les quantités sont diminuées directement dans le carnet, et seuls les ordres totalement exécutés en sont retirés.
+    // Les trades et les résultats des ordres impactés sont écrits dans les buffers de l'engine (vidés ici,
+    // capacité conservée) : un ordre LIMIT qui ne croise pas le carnet ne fait aucune allocation.
     // ################################################################################################
     
-    // Initialisation du vecteur des matchs, du vecteur des ordres impactés et de la quantité restante dans l'ordre arrivé.
-    std::vector<Trade> matches;
-    std::vector<OrderResult> impacted_orders;  
+    // Remise à zéro des buffers et initialisation de la quantité restante dans l'ordre arrivé.
+    trade_buffer.clear();
+    pending_impacted_orders.clear();
     int remaining_quantity = incoming_order.quantity;
     
     // Si ordre d'achat, on match contre le book de vente
-    if (incoming_order.side == "BUY") {
+    if (incoming_order.side == Side::BUY) {
         
-        std::cout << "Matching de l'ordre d'achat contre le carnet des ventes" << std::endl;
- 
-        // Initialisation d'un vecteur qui contiendra les ordres de vente non matchés
-        std::vector<Order> temp_orders;
+        LOG_DEBUG("Matching de l'ordre d'achat contre le carnet des ventes");
         
         // On boucle tant que deux conditions sont remplies : il y a encore des ordres de vente dans le carnet
         // et l'ordre d'achat n'est pas totalement exécuté
-        while (!sell_book.empty() && remaining_quantity > 0) {
-            // Récupération du meilleur ordre de vente (prix le plus bas)
-            Order best_sell = sell_book.top();
-            // On retire temporairement l'ordre du carnet de vente
-            sell_book.pop();
+        while (book.bestSell() != NULL_HANDLE && remaining_quantity > 0) {
+            // Récupération du meilleur ordre de vente (prix le plus bas, puis le plus ancien)
+            OrderHandle best_handle = book.bestSell();
+            Order& best_sell = book.get(best_handle);
             
             // Gestion des types d'ordre : le market peut toujours matcher (sauf si book vide),
             // le limit matche si le prix d'achat est supérieur ou égal au prix de vente
             bool can_match = false;
-            if (incoming_order.type == "MARKET") {
+            if (incoming_order.type == OrderType::MARKET) {
                 can_match = true;  // MARKET order matche toujours
-                std::cout << "MARKET BUY - Match automatique avec SELL " << best_sell.price << std::endl;
+                LOG_DEBUG("MARKET BUY - Match automatique avec SELL ", best_sell.price);
             } else {
                 can_match = (incoming_order.price >= best_sell.price);
                 if (can_match) {
-                    std::cout << "LIMIT BUY " << incoming_order.price << " >= SELL " << best_sell.price << " - Match OK" << std::endl;
+                    LOG_DEBUG("LIMIT BUY ", incoming_order.price, " >= SELL ", best_sell.price, " - Match OK");
                 } else {
-                    std::cout << "LIMIT BUY " << incoming_order.price << " < SELL " << best_sell.price << " - Pas de match" << std::endl;
+                    LOG_DEBUG("LIMIT BUY ", incoming_order.price, " < SELL ", best_sell.price, " - Pas de match");
                 }
             }
             
-            if(can_match){
-                int trade_quantity = std::min(remaining_quantity, best_sell.quantity);
-                
-                // Création du trade au prix du vendeur
-                Trade trade(incoming_order.timestamp, incoming_order.order_id, best_sell.order_id,
-                            incoming_order.instrument, trade_quantity, best_sell.price);
-                matches.push_back(trade);
-                
-                // Mise à jour des quantités pour chaque ordre
-                remaining_quantity -= trade_quantity;
-                best_sell.quantity -= trade_quantity;
-                
-                // Si l'ordre de vente n'est pas complètement exécuté, on le remet dans le carnet
-                // Comme seule sa quantité est modifiée, les règles sur les prix et timestamp sont toujours appliquées
-                if (best_sell.quantity > 0) {
-                    temp_orders.push_back(best_sell);
-                    // Mise à jour dans la map
-                    order_map[best_sell.order_id] = best_sell;
-                } else {
-                    // Si ordre de vente totalement exécuté, on le retire de la map
-                    order_map.erase(best_sell.order_id);
-                }
-                
-                // On copie l'ordre de vente impacté pour l'historique
-                Order matched_sell = best_sell;
- 
-                // On détermine le statut de l'ordre de vente (totalement exécuté ou partiellement)
-                std::string sell_status = (best_sell.quantity == 0) ? "EXECUTED" : "PARTIALLY_EXECUTED";
-                std::cout << "Ordre SELL impacté : quantité = " << matched_sell.quantity
-                    << ", status=" << sell_status << std::endl;
-                OrderResult sell_result = createResult(matched_sell, sell_status,
-                                     trade_quantity, best_sell.price, incoming_order.order_id);
-                std::cout << "Résultat SELL : quantité = " << sell_result.original_order.quantity
-                    << ", status = " << sell_result.status << std::endl;
-                // On s'assure que la modification de l'ordre impacté apparaît bien en même temps que l'ordre d'achat
-                sell_result.original_order.timestamp = incoming_order.timestamp;
- 
-                impacted_orders.push_back(sell_result);
-            } else {
-                // Si l'une des deux conditions n'est pas respectée -> on arrête.
-                temp_orders.push_back(best_sell);
+            // Si le meilleur prix ne convient pas, aucun autre ordre du carnet ne conviendra -> on arrête.
+            if (!can_match) {
                 break;
             }
-        }
-        
-        // On remet les ordres non matchés dans le carnet
-        for (const Order& order : temp_orders) {
-            sell_book.push(order);
+            
+            int trade_quantity = std::min(remaining_quantity, best_sell.quantity);
+            
+            // Création du trade au prix du vendeur
+            trade_buffer.emplace_back(incoming_order.timestamp, incoming_order.order_id, best_sell.order_id,
+                                      trade_quantity, best_sell.price);
+            
+            // Mise à jour des quantités pour chaque ordre (l'ordre de vente garde sa place dans la file)
+            remaining_quantity -= trade_quantity;
+            book.reduce(best_handle, trade_quantity);
+            
+            // On détermine le statut de l'ordre de vente (totalement exécuté ou partiellement)
+            // et on écrit son résultat directement dans le buffer des ordres impactés
+            OrderStatus sell_status = (best_sell.quantity == 0) ? OrderStatus::EXECUTED : OrderStatus::PARTIALLY_EXECUTED;
+            LOG_DEBUG("Ordre SELL impacté : quantité = ", best_sell.quantity, ", status = ", sell_status);
+            OrderResult& sell_result = pending_impacted_orders.emplace_back(best_sell);
+            sell_result.status = sell_status;
+            sell_result.executed_quantity = trade_quantity;
+            sell_result.execution_price = best_sell.price;
+            sell_result.counterparty_id = incoming_order.order_id;
+            // On s'assure que la modification de l'ordre impacté apparaît bien en même temps que l'ordre d'achat
+            sell_result.original_order.timestamp = incoming_order.timestamp;
+            
+            // Si ordre de vente totalement exécuté, on le retire du carnet et de l'index
+            // (uniquement après avoir écrit son résultat : son emplacement peut ensuite être réutilisé)
+            if (sell_status == OrderStatus::EXECUTED) {
+                removeFromBook(best_sell.order_id);
+            }
         }
         // On a donc au final les ordres de vente partiellement exécutés et non impactés dans le carnet,
         // les ordres de vente exécutés ont été sortis du carnet, et l'historique des trades a été mis à jour.
         
         // On procède de la même manière si l'ordre nouveau est un ordre de vente
-    } else if (incoming_order.side == "SELL") {
+    } else if (incoming_order.side == Side::SELL) {
  
-        std::cout << "Matching des ordres de vente contre le carnet d'achat" << std::endl;
-        
-        std::vector<Order> temp_orders;
+        LOG_DEBUG("Matching des ordres de vente contre le carnet d'achat");
         
-        while (!buy_book.empty() && remaining_quantity > 0) {
-            Order best_buy = buy_book.top();
-            buy_book.pop();
+        while (book.bestBuy() != NULL_HANDLE && remaining_quantity > 0) {
+            OrderHandle best_handle = book.bestBuy();
+            Order& best_buy = book.get(best_handle);
  
             bool can_match = false;
-            if (incoming_order.type == "MARKET") {
+            if (incoming_order.type == OrderType::MARKET) {
                 can_match = true;  // MARKET order matche toujours
-                std::cout << "MARKET SELL - Match automatique avec BUY " << best_buy.price << std::endl;
+                LOG_DEBUG("MARKET SELL - Match automatique avec BUY ", best_buy.price);
             } else {
                 can_match = (best_buy.price >= incoming_order.price);
                 if (can_match) {
-                    std::cout << "BUY " << best_buy.price << " >= LIMIT SELL " << incoming_order.price << " - Match OK" << std::endl;
+                    LOG_DEBUG("BUY ", best_buy.price, " >= LIMIT SELL ", incoming_order.price, " - Match OK");
                 } else {
-                    std::cout << "BUY " << best_buy.price << " < LIMIT SELL " << incoming_order.price << " - Pas de match" << std::endl;
+                    LOG_DEBUG("BUY ", best_buy.price, " < LIMIT SELL ", incoming_order.price, " - Pas de match");
                 }
             }
             
-            if (can_match) {
-                int trade_quantity = std::min(remaining_quantity, best_buy.quantity);
-                
-                Trade trade(incoming_order.timestamp, best_buy.order_id, incoming_order.order_id,
-                           incoming_order.instrument, trade_quantity, best_buy.price);
-                matches.push_back(trade);
-                
-                remaining_quantity -= trade_quantity;
-                best_buy.quantity -= trade_quantity;
-                
-                if (best_buy.quantity > 0) {
-                    temp_orders.push_back(best_buy);
-                    order_map[best_buy.order_id] = best_buy;
-                } else {
-                    order_map.erase(best_buy.order_id);
-                }
-                
-                Order matched_buy = best_buy;
-                
-                std::string buy_status = (best_buy.quantity == 0) ? "EXECUTED" : "PARTIALLY_EXECUTED";
-                OrderResult buy_result = createResult(matched_buy, buy_status,
-                                                    trade_quantity, best_buy.price, incoming_order.order_id);
-                buy_result.original_order.timestamp = incoming_order.timestamp;
-                impacted_orders.push_back(buy_result);
-            } else {
-                temp_orders.push_back(best_buy);
+            if (!can_match) {
                 break;
             }
-        }
-        
-        for (const Order& order : temp_orders) {
-            buy_book.push(order);
+            
+            int trade_quantity = std::min(remaining_quantity, best_buy.quantity);
+            
+            trade_buffer.emplace_back(incoming_order.timestamp, best_buy.order_id, incoming_order.order_id,
+                                      trade_quantity, best_buy.price);
+            
+            remaining_quantity -= trade_quantity;
+            book.reduce(best_handle, trade_quantity);
+            
+            OrderStatus buy_status = (best_buy.quantity == 0) ? OrderStatus::EXECUTED : OrderStatus::PARTIALLY_EXECUTED;
+            OrderResult& buy_result = pending_impacted_orders.emplace_back(best_buy);
+            buy_result.status = buy_status;
+            buy_result.executed_quantity = trade_quantity;
+            buy_result.execution_price = best_buy.price;
+            buy_result.counterparty_id = incoming_order.order_id;
+            buy_result.original_order.timestamp = incoming_order.timestamp;
+            
+            if (buy_status == OrderStatus::EXECUTED) {
+                removeFromBook(best_buy.order_id);
+            }
         }
     }
     
-    // On met à jour la quantité restante de l'ordre entrant puis on met à jour les impacts dans l'historique
-    incoming_order.quantity = remaining_quantity;
-    pending_impacted_orders = impacted_orders;
-    
-    return matches;
+    // Les trades (et donc la quantité restante de l'ordre entrant) et les impacts sont dans les buffers
+    return trade_buffer;
 }
  
  
 void MatchingEngine::addToBook(const Order& order) {
+    addToBook(order, OrderState{order.quantity, 0, OrderStatus::PENDING});
+}
+ 
+void MatchingEngine::addToBook(const Order& order, const OrderState& state) {
     // ################################################################################################
     // Fonction qui permet l'ajout d'ordres au book approprié.
+    // L'ordre est placé en fin de file de son niveau de prix, et son handle est enregistré dans l'index
     // ################################################################################################
  
     // Les ordres au marché ne sont jamais ajoutés au carnet
-    if (order.type == "MARKET") {
-        std::cout << "ERREUR: Tentative d'ajout d'un ordre MARKET au carnet !" << std::endl;
+    if (order.type == OrderType::MARKET) {
+        LOG_ERROR("Tentative d'ajout d'un ordre MARKET au carnet !");
         return;
     }
     
     // Si ordre d'achat : ajout au book d'achat, sinon à celui de vente
-    if (order.side == "BUY") {
-        buy_book.push(order);
-        std::cout << "Ajouté au BUY book: " << order.quantity << " @ " << order.price << std::endl;
-    } else if (order.side == "SELL") {
-        sell_book.push(order);
-        std::cout << "Ajouté au SELL book: " << order.quantity << " @ " << order.price << std::endl;
+    if (order.side == Side::BUY || order.side == Side::SELL) {
+        order_index.insert(order.order_id, book.add(order, state));
+        LOG_DEBUG("Ajouté au ", order.side, " book: ", order.quantity, " @ ", order.price);
     }
 }
  
-bool MatchingEngine::removeFromBook(int order_id, const std::string& side) {
+bool MatchingEngine::removeFromBook(int order_id) {
     // ################################################################################################
     // Fonction qui permet la suppression d'ordres du book approprié.
-    // Difficile de vraiment retirer des lignes avec un objet order_queue, donc ce qu'on fait,
-    // c'est qu'on dit qu'il est retiré (même si dans les faits il est toujours dans le book priority-queue),
-    // mais par contre, à chaque fois dans le tryMatch, on le RETIRE DE LA MAP, donc on ne peut jamais matché avec.
-    // (c'est du "soft deletion")
+    // On retrouve le handle de l'ordre grâce à l'index, puis on le décroche directement de la file
+    // de son niveau de prix : il ne peut donc plus jamais être matché.
     // ################################################################################################
     
-    std::cout << "Suppression de l'ordre " << order_id << " du " << side << " book" << std::endl;
-    
-    if (side == "BUY") {
-        std::cout << "Ordre BUY " << order_id << " marqué comme supprimé" << std::endl;
-        return true;
-    } else if (side == "SELL") {
-        std::cout << "Ordre SELL " << order_id << " marqué comme supprimé" << std::endl;
-        return true;
+    OrderHandle handle = order_index.find(order_id);
+    if (handle == NULL_HANDLE) {
+        return false;
     }
     
-    return false;
+    LOG_DEBUG("Suppression de l'ordre ", order_id, " du ", book.get(handle).side, " book");
+    book.remove(handle);
+    order_index.erase(order_id);
+    return true;
 }
  
 // Affichage des carnets
 void MatchingEngine::displayBooks() const {
+    LOG_FLUSH();
     std::cout << "\n=== ÉTAT DES CARNETS ===" << std::endl;
-    std::cout << "BUY book size: " << buy_book.size() << std::endl;
-    std::cout << "SELL book size: " << sell_book.size() << std::endl;
+    std::cout << "BUY book size: " << book.buySize() << " (" << book.buyLevels() << " niveaux de prix)" << std::endl;
+    std::cout << "SELL book size: " << book.sellSize() << " (" << book.sellLevels() << " niveaux de prix)" << std::endl;
+
+    // Cinq meilleurs niveaux de chaque côté (prix, quantité agrégée, nombre d'ordres)
+    constexpr size_t DISPLAYED_LEVELS = 5;
+    DepthLevel levels[DISPLAYED_LEVELS];
+    for (Side side : {Side::BUY, Side::SELL}) {
+        size_t count = book.depth(side, DISPLAYED_LEVELS, levels);
+        std::cout << side << " (prix en ticks) :";
+        for (size_t i = 0; i < count; i++) {
+            std::cout << " " << levels[i].price << " x " << levels[i].quantity << " (" << levels[i].order_count << ")";
+        }
+        std::cout << std::endl;
+    }
 }
  
+// Abonné appelé à chaque résultat (nullptr : aucun)
+void MatchingEngine::setListener(EngineListener* new_listener) {
+    listener = new_listener;
+}
+
 // Récupération des résultats (historic_trades)
-const std::vector<OrderResult>& MatchingEngine::getResults() const {
+const ResultTable& MatchingEngine::getResults() const {
     return historic_trades;
 }
  
+// Transfert des résultats accumulés vers l'appelant (mode continu : l'historique ne grossit pas indéfiniment)
+void MatchingEngine::drainResults(std::vector<OrderResult>& out) {
+    for (size_t i = 0; i < historic_trades.size(); i++) {
+        out.push_back(historic_trades[i]);
+    }
+    historic_trades.clear();
+}
+ 
+void MatchingEngine::drainResults(ResultTable& out) {
+    if (out.empty()) {
+        out.swap(historic_trades);
+        return;
+    }
+    for (size_t i = 0; i < historic_trades.size(); i++) {
+        out.append(historic_trades[i]);
+    }
+    historic_trades.clear();
+}
+
 // Affichage des résultats (renvoie historic_trades)
 void MatchingEngine::displayResults() const {
+    LOG_FLUSH();
     std::cout << "\n=== HISTORIC_TRADES (OUTPUT FINAL) ===" << std::endl;
     std::cout << "Timestamp - OrderID - Instrument - Side - Type - Qty - Price - Action - Status - ExecQty - ExecPrice - Counterparty" << std::endl;
     
-    for (const OrderResult& result : historic_trades) {
+    for (size_t i = 0; i < historic_trades.size(); i++) {
+        OrderResult result = historic_trades[i];
         const Order& order = result.original_order;
+        TickSize tick = order.instrument.tick();
         std::cout << order.timestamp << " "
                   << order.order_id << " "
                   << order.instrument << " "
                   << order.side << " "
                   << order.type << " "
                   << order.quantity << " "
-                  << order.price << " "
+                  << priceToDouble(order.price, tick) << " "
                   << order.action << " "
                   << result.status << " "
                   << result.executed_quantity << " "
-                  << result.execution_price << " "
+                  << priceToDouble(result.execution_price, tick) << " "
                   << result.counterparty_id << std::endl;
     }
 }
@@ -614,14 +659,3 @@ long long MatchingEngine::getCurrentTimestamp() {
     // Pour les modifications, on génère un nouveau timestamp (perte de priorité)
     return ++current_timestamp + 1617278400000000000LL;
 }
- 
-OrderResult MatchingEngine::createResult(const Order& order, const std::string& status,
-                                       int exec_qty, float exec_price, int counterparty) {
-    // Création du format des résultats
-    OrderResult result(order);
-    result.status = status;
-    result.executed_quantity = exec_qty;
-    result.execution_price = exec_price;
-    result.counterparty_id = counterparty;
-    return result;
-}
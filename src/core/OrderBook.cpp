@@ -0,0 +1,167 @@
+#include "core/OrderBook.h"
+
+// Constructeur : réservation des noeuds des ordres et des niveaux de prix
+OrderBook::OrderBook(size_t order_capacity, size_t level_capacity)
+    : level_pool(level_capacity), buy_levels(LevelMap::allocator_type(&level_pool)),
+      sell_levels(LevelMap::allocator_type(&level_pool)), free_head(NULL_HANDLE), buy_count(0), sell_count(0),
+      best_bid(INT64_MIN), best_ask(INT64_MAX), track_deltas(false), delta_epoch(1) {
+    nodes.reserve(order_capacity);
+    deltas.reserve(64);
+}
+
+OrderHandle OrderBook::add(const Order& order, const OrderState& state) {
+    // ################################################################################################
+    // Ajout d'un ordre au repos : on récupère (ou crée) son niveau de prix, puis on chaîne l'ordre
+    // en fin de file (priorité temporelle : le dernier arrivé est servi en dernier à prix égal)
+    // ################################################################################################
+    bool is_buy = (order.side == Side::BUY);
+    LevelMap& levels = is_buy ? buy_levels : sell_levels;
+    Price key = is_buy ? -order.price : order.price;
+
+    // Récupération d'un emplacement libre (recyclé si possible)
+    OrderHandle handle;
+    if (free_head != NULL_HANDLE) {
+        handle = free_head;
+        free_head = nodes[handle].next;
+    } else {
+        handle = static_cast<OrderHandle>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    // Récupération du niveau de prix (créé vide s'il n'existe pas, en mettant à jour le meilleur prix)
+    auto [level_it, created] = levels.try_emplace(key, PriceLevel{order.price, NULL_HANDLE, NULL_HANDLE, 0, 0, 0, 0});
+    PriceLevel& level = level_it->second;
+    if (created) {
+        if (is_buy && order.price > best_bid) {
+            best_bid = order.price;
+        } else if (!is_buy && order.price < best_ask) {
+            best_ask = order.price;
+        }
+    }
+
+    BookNode& node = nodes[handle];
+    node.order = order;
+    node.state = state;
+    node.prev = level.tail;
+    node.next = NULL_HANDLE;
+    node.level = level_it;
+    node.is_buy = is_buy;
+
+    // Chaînage en fin de file
+    if (level.tail != NULL_HANDLE) {
+        nodes[level.tail].next = handle;
+    } else {
+        level.head = handle;
+    }
+    level.tail = handle;
+    level.total_quantity += order.quantity;
+    level.order_count++;
+    recordDelta(level, is_buy);
+
+    if (is_buy) {
+        buy_count++;
+    } else {
+        sell_count++;
+    }
+    return handle;
+}
+
+void OrderBook::remove(OrderHandle handle) {
+    // ################################################################################################
+    // Retrait d'un ordre : on le décroche de la file de son niveau grâce à ses voisins (O(1)),
+    // on supprime le niveau s'il devient vide et on recycle l'emplacement du noeud
+    // ################################################################################################
+    BookNode& node = nodes[handle];
+    PriceLevel& level = node.level->second;
+
+    if (node.prev != NULL_HANDLE) {
+        nodes[node.prev].next = node.next;
+    } else {
+        level.head = node.next;
+    }
+    if (node.next != NULL_HANDLE) {
+        nodes[node.next].prev = node.prev;
+    } else {
+        level.tail = node.prev;
+    }
+    level.total_quantity -= node.order.quantity;
+    level.order_count--;
+    recordDelta(level, node.is_buy);
+
+    LevelMap& levels = node.is_buy ? buy_levels : sell_levels;
+    if (level.order_count == 0) {
+        levels.erase(node.level);
+        refreshBest(node.is_buy);
+    }
+
+    if (node.is_buy) {
+        buy_count--;
+    } else {
+        sell_count--;
+    }
+    node.next = free_head;
+    free_head = handle;
+}
+
+void OrderBook::reduce(OrderHandle handle, int quantity) {
+    // L'ordre garde sa place dans la file : seule sa quantité (et celle du niveau) diminue
+    BookNode& node = nodes[handle];
+    node.order.quantity -= quantity;
+    node.level->second.total_quantity -= quantity;
+    node.state.filled_quantity += quantity;
+    node.state.last_status = (node.order.quantity == 0) ? OrderStatus::EXECUTED : OrderStatus::PARTIALLY_EXECUTED;
+    recordDelta(node.level->second, node.is_buy);
+}
+
+OrderHandle OrderBook::bestBuy() const {
+    return buy_levels.empty() ? NULL_HANDLE : buy_levels.begin()->second.head;
+}
+
+OrderHandle OrderBook::bestSell() const {
+    return sell_levels.empty() ? NULL_HANDLE : sell_levels.begin()->second.head;
+}
+
+TopOfBook OrderBook::topOfBook() const {
+    TopOfBook top{{0, 0, 0}, {0, 0, 0}, !buy_levels.empty(), !sell_levels.empty()};
+    if (top.has_bid) {
+        const PriceLevel& level = buy_levels.begin()->second;
+        top.bid = DepthLevel{level.price, level.total_quantity, level.order_count};
+    }
+    if (top.has_ask) {
+        const PriceLevel& level = sell_levels.begin()->second;
+        top.ask = DepthLevel{level.price, level.total_quantity, level.order_count};
+    }
+    return top;
+}
+
+size_t OrderBook::depth(Side side, size_t max_levels, DepthLevel* out) const {
+    // Les niveaux sont déjà triés du meilleur au moins bon : on lit les max_levels premiers
+    const LevelMap& levels = (side == Side::BUY) ? buy_levels : sell_levels;
+    size_t count = 0;
+    for (auto it = levels.begin(); it != levels.end() && count < max_levels; ++it, ++count) {
+        out[count] = DepthLevel{it->second.price, it->second.total_quantity, it->second.order_count};
+    }
+    return count;
+}
+
+void OrderBook::recordDelta(PriceLevel& level, bool is_buy) {
+    if (!track_deltas) {
+        return;
+    }
+    LevelDelta delta{is_buy ? Side::BUY : Side::SELL, level.price, level.total_quantity, level.order_count};
+    if (level.delta_epoch == delta_epoch) {
+        deltas[level.delta_slot] = delta;
+    } else {
+        level.delta_epoch = delta_epoch;
+        level.delta_slot = static_cast<uint32_t>(deltas.size());
+        deltas.push_back(delta);
+    }
+}
+
+void OrderBook::refreshBest(bool is_buy) {
+    if (is_buy) {
+        best_bid = buy_levels.empty() ? INT64_MIN : buy_levels.begin()->second.price;
+    } else {
+        best_ask = sell_levels.empty() ? INT64_MAX : sell_levels.begin()->second.price;
+    }
+}
@@ -0,0 +1,98 @@
+#include "core/OrderIndex.h"
+
+namespace {
+    // Plus petite puissance de 2 supérieure ou égale à n (au moins 16)
+    size_t nextPowerOfTwo(size_t n) {
+        size_t capacity = 16;
+        while (capacity < n) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+}
+
+// Constructeur
+OrderIndex::OrderIndex(size_t initial_capacity) : mask(0), count(0) {
+    size_t capacity = nextPowerOfTwo(initial_capacity);
+    slots.assign(capacity, Slot{0, NULL_HANDLE});
+    mask = capacity - 1;
+}
+
+OrderHandle OrderIndex::find(int order_id) const {
+    // Sondage linéaire à partir de la case idéale, jusqu'à trouver l'ID ou une case vide
+    size_t pos = bucket(order_id);
+    while (slots[pos].handle != NULL_HANDLE) {
+        if (slots[pos].order_id == order_id) {
+            return slots[pos].handle;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return NULL_HANDLE;
+}
+
+void OrderIndex::insert(int order_id, OrderHandle handle) {
+    // Agrandissement si le taux de remplissage dépasserait 70%
+    if ((count + 1) * 10 > slots.size() * 7) {
+        rehash(slots.size() * 2);
+    }
+
+    size_t pos = bucket(order_id);
+    while (slots[pos].handle != NULL_HANDLE) {
+        // ID déjà présent : mise à jour du handle
+        if (slots[pos].order_id == order_id) {
+            slots[pos].handle = handle;
+            return;
+        }
+        pos = (pos + 1) & mask;
+    }
+    slots[pos] = Slot{order_id, handle};
+    count++;
+}
+
+bool OrderIndex::erase(int order_id) {
+    size_t pos = bucket(order_id);
+    while (slots[pos].handle != NULL_HANDLE && slots[pos].order_id != order_id) {
+        pos = (pos + 1) & mask;
+    }
+    if (slots[pos].handle == NULL_HANDLE) {
+        return false;
+    }
+
+    // Suppression par décalage arrière : on remonte dans le trou les entrées suivantes de la même
+    // chaîne de sondage qui ne seraient plus trouvables sinon (leur case idéale est avant le trou)
+    size_t hole = pos;
+    size_t next = (hole + 1) & mask;
+    while (slots[next].handle != NULL_HANDLE) {
+        size_t ideal = bucket(slots[next].order_id);
+        // Distance (circulaire) entre la case idéale et la case actuelle, comparée à celle du trou
+        if (((next - ideal) & mask) >= ((next - hole) & mask)) {
+            slots[hole] = slots[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    slots[hole] = Slot{0, NULL_HANDLE};
+    count--;
+    return true;
+}
+
+void OrderIndex::reserve(size_t expected_orders) {
+    size_t needed = nextPowerOfTwo(expected_orders * 10 / 7 + 1);
+    if (needed > slots.size()) {
+        rehash(needed);
+    }
+}
+
+void OrderIndex::rehash(size_t new_capacity) {
+    std::vector<Slot> old_slots;
+    old_slots.swap(slots);
+    slots.assign(new_capacity, Slot{0, NULL_HANDLE});
+    mask = new_capacity - 1;
+    count = 0;
+
+    for (const Slot& slot : old_slots) {
+        if (slot.handle != NULL_HANDLE) {
+            insert(slot.order_id, slot.handle);
+        }
+    }
+}
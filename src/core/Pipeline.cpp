@@ -0,0 +1,246 @@
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include "core/Pipeline.h"
+#include "data/CSVReader.h"
+#include "data/CSVWriter.h"
+#include "utils/Logger.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // Dépôt dans une file, en attendant qu'une place se libère. Renvoie le temps d'attente (en secondes).
+    template <typename T>
+    double pushWait(SpscQueue<T>& queue, T& value) {
+        if (queue.tryPush(std::move(value))) {
+            return 0.0;
+        }
+        Clock::time_point start = Clock::now();
+        unsigned idle_rounds = 0;
+        do {
+            waitBackoff(idle_rounds);
+        } while (!queue.tryPush(std::move(value)));
+        return secondsSince(start);
+    }
+
+    // Retrait d'une file, en attendant qu'un élément arrive. Renvoie le temps d'attente (en secondes).
+    template <typename T>
+    double popWait(SpscQueue<T>& queue, T& value) {
+        if (queue.tryPop(value)) {
+            return 0.0;
+        }
+        Clock::time_point start = Clock::now();
+        unsigned idle_rounds = 0;
+        do {
+            waitBackoff(idle_rounds);
+        } while (!queue.tryPop(value));
+        return secondsSince(start);
+    }
+}
+
+// Constructeur
+Pipeline::Pipeline(std::string input_file, std::string output_prefix, size_t batch_size, size_t queue_depth)
+    : input_file(std::move(input_file)), output_prefix(std::move(output_prefix)),
+      batch_size(batch_size == 0 ? 1 : batch_size),
+      lines(queue_depth), parsed(queue_depth), matched(queue_depth), formatted(queue_depth) {}
+
+const PipelineStats& Pipeline::run() {
+    stats_ = PipelineStats();
+    Clock::time_point start = Clock::now();
+
+    std::thread read_thread(&Pipeline::readStage, this);
+    std::thread parse_thread(&Pipeline::parseStage, this);
+    std::thread match_thread(&Pipeline::matchStage, this);
+    std::thread format_thread(&Pipeline::formatStage, this);
+    writeStage();
+
+    read_thread.join();
+    parse_thread.join();
+    match_thread.join();
+    format_thread.join();
+    stats_.total_seconds = secondsSince(start);
+
+    LOG_INFO("Pipeline : ", stats_.orders, " ordres, ", stats_.results, " résultats en ", stats_.total_seconds, " s");
+    return stats_;
+}
+
+void Pipeline::readStage() {
+    // Lecture du fichier par lots de lignes brutes, chaque lot est passé à la validation dès qu'il est complet
+    Clock::time_point start = Clock::now();
+    double waited = 0.0;
+    CsvReader reader(input_file);
+    reader.readLineBatches(batch_size, [this, &waited](std::string& batch) {
+        Item<std::string> item(std::move(batch));
+        waited += pushWait(lines, item);
+    });
+
+    // Fin du flux
+    Item<std::string> end_of_stream;
+    waited += pushWait(lines, end_of_stream);
+    stats_.read_seconds = secondsSince(start) - waited;
+}
+
+void Pipeline::parseStage() {
+    // Validation des lignes de chaque lot (champs lus et contrôlés, lignes invalides en BAD_INPUT)
+    Clock::time_point start = Clock::now();
+    double waited = 0.0;
+    CsvReader reader;
+
+    Item<std::string> text;
+    while (true) {
+        waited += popWait(lines, text);
+        if (!text) {
+            break;
+        }
+        Item<std::vector<Order>> batch(std::in_place);
+        batch->reserve(batch_size);
+        reader.parseLines(*text, *batch);
+        stats_.orders += batch->size();
+        if (!batch->empty()) {
+            waited += pushWait(parsed, batch);
+        }
+    }
+
+    // Fin du flux
+    Item<std::vector<Order>> end_of_stream;
+    waited += pushWait(parsed, end_of_stream);
+    stats_.parse_seconds = secondsSince(start) - waited;
+}
+
+void Pipeline::matchStage() {
+    // Un matching engine par actif, alimenté ordre par ordre (dans l'ordre du fichier)
+    Clock::time_point start = Clock::now();
+    double waited = 0.0;
+    std::vector<std::unique_ptr<MatchingEngine>> engines;    // indexés par ID d'instrument
+    long long last_timestamp = 0;
+    size_t out_of_order = 0;
+
+    Item<std::vector<Order>> batch;
+    while (true) {
+        waited += popWait(parsed, batch);
+        if (!batch) {
+            break;
+        }
+
+        Item<std::vector<OrderResult>> results(std::in_place);
+        results->reserve(batch->size() + batch->size() / 2);
+        for (const Order& order : *batch) {
+            if (order.timestamp < last_timestamp) {
+                out_of_order++;
+            } else {
+                last_timestamp = order.timestamp;
+            }
+            if (order.instrument.id >= engines.size()) {
+                engines.resize(order.instrument.id + 1);
+            }
+            std::unique_ptr<MatchingEngine>& engine = engines[order.instrument.id];
+            if (!engine) {
+                engine = std::make_unique<MatchingEngine>();
+            }
+            engine->processOrder(order);
+            engine->drainResults(*results);
+        }
+        waited += pushWait(matched, results);
+    }
+
+    if (out_of_order > 0) {
+        LOG_WARN("Pipeline : ", out_of_order, " ordres hors ordre chronologique, traités dans l'ordre du fichier");
+    }
+    Item<std::vector<OrderResult>> end_of_stream;
+    waited += pushWait(matched, end_of_stream);
+    stats_.match_seconds = secondsSince(start) - waited;
+}
+
+void Pipeline::formatStage() {
+    // Mise en forme des résultats en lignes de CSV, regroupées par actif (un texte par actif et par lot)
+    Clock::time_point start = Clock::now();
+    double waited = 0.0;
+    CsvWriter writer;
+    constexpr size_t NO_POSITION = SIZE_MAX;
+    std::vector<size_t> positions;   // ID d'actif -> position dans le lot formaté
+
+    Item<std::vector<OrderResult>> results;
+    while (true) {
+        waited += popWait(matched, results);
+        if (!results) {
+            break;
+        }
+        stats_.results += results->size();
+
+        Item<FormattedBatch> batch(std::in_place);
+        for (const OrderResult& result : *results) {
+            Instrument instrument = result.original_order.instrument;
+            if (instrument.id >= positions.size()) {
+                positions.resize(instrument.id + 1, NO_POSITION);
+            }
+            size_t& position = positions[instrument.id];
+            if (position == NO_POSITION) {
+                position = batch->size();
+                batch->emplace_back(instrument, std::string());
+            }
+            writer.appendRow(result, (*batch)[position].second);
+        }
+        // Remise à zéro des positions des actifs de ce lot uniquement
+        for (const auto& entry : *batch) {
+            positions[entry.first.id] = NO_POSITION;
+        }
+        waited += pushWait(formatted, batch);
+    }
+
+    Item<FormattedBatch> end_of_stream;
+    waited += pushWait(formatted, end_of_stream);
+    stats_.format_seconds = secondsSince(start) - waited;
+}
+
+void Pipeline::writeStage() {
+    // Écriture des lignes dans le fichier de chaque actif (ouvert, avec sa ligne de titre, au premier résultat)
+    Clock::time_point start = Clock::now();
+    double waited = 0.0;
+    std::vector<std::unique_ptr<std::ofstream>> files;     // indexés par ID d'actif
+
+    Item<FormattedBatch> batch;
+    while (true) {
+        waited += popWait(formatted, batch);
+        if (!batch) {
+            break;
+        }
+        for (const auto& [instrument, text] : *batch) {
+            if (instrument.id >= files.size()) {
+                files.resize(instrument.id + 1);
+            }
+            std::unique_ptr<std::ofstream>& file = files[instrument.id];
+            if (!file) {
+                std::string path = output_prefix + instrument.name() + ".csv";
+                file = std::make_unique<std::ofstream>(path, std::ios::binary);
+                if (!file->is_open()) {
+                    LOG_ERROR("Impossible d'ouvrir ", path);
+                    stats_.failed_files++;
+                    continue;
+                }
+                *file << CsvWriter::header() << '\n';
+            }
+            // Fichier qui n'a pas pu être ouvert : les lignes de l'actif sont ignorées (erreur déjà signalée)
+            if (file->is_open()) {
+                file->write(text.data(), static_cast<std::streamsize>(text.size()));
+            }
+        }
+    }
+
+    // Fermeture des fichiers, et contrôle de l'écriture complète de chacun
+    for (size_t id = 0; id < files.size(); id++) {
+        if (files[id] && files[id]->is_open()) {
+            files[id]->close();
+            if (!*files[id]) {
+                LOG_ERROR("Erreur d'écriture dans ", output_prefix + Instrument::fromId(static_cast<InstrumentId>(id)).name() + ".csv");
+                stats_.failed_files++;
+            }
+        }
+    }
+    files.clear();
+    stats_.write_seconds = secondsSince(start) - waited;
+}
@@ -0,0 +1,23 @@
+#include "core/Price.h"
+#include "core/SymbolTable.h"
+
+// Table statique (initialisée au premier appel)
+std::map<std::string, TickSize, std::less<>>& TickTable::table() {
+    static std::map<std::string, TickSize, std::less<>> ticks;
+    return ticks;
+}
+
+void TickTable::set(const std::string& instrument, TickSize tick) {
+    table()[instrument] = tick;
+    // Un instrument déjà enregistré garde une copie de son tick dans la table des symboles
+    SymbolTable::updateTick(instrument, tick);
+}
+
+TickSize TickTable::get(std::string_view instrument) {
+    const std::map<std::string, TickSize, std::less<>>& ticks = table();
+    auto it = ticks.find(instrument);
+    if (it == ticks.end()) {
+        return DEFAULT_TICK_SIZE;
+    }
+    return it->second;
+}
@@ -0,0 +1,74 @@
+#include "core/ResultTable.h"
+#include <utility>
+
+ResultTable::ResultTable() : count_(0) {}
+
+ResultTable::~ResultTable() = default;
+
+ResultTable::ResultTable(ResultTable&& other) noexcept : chunks_(std::move(other.chunks_)), count_(other.count_) {
+    other.count_ = 0;
+}
+
+ResultTable& ResultTable::operator=(ResultTable&& other) noexcept {
+    chunks_ = std::move(other.chunks_);
+    count_ = other.count_;
+    other.count_ = 0;
+    return *this;
+}
+
+void ResultTable::swap(ResultTable& other) noexcept {
+    chunks_.swap(other.chunks_);
+    std::swap(count_, other.count_);
+}
+
+void ResultTable::reserve(size_t capacity) {
+    size_t needed = (capacity + CHUNK_SIZE - 1) >> CHUNK_BITS;
+    if (needed <= chunks_.size()) {
+        return;
+    }
+    chunks_.reserve(needed);
+    while (chunks_.size() < needed) {
+        chunks_.push_back(std::make_unique<Chunk>());
+    }
+}
+
+void ResultTable::append(const Order& order, OrderStatus status, int executed_quantity, Price execution_price,
+                         int counterparty_id) {
+    // Nouveau bloc seulement quand tous les blocs déjà alloués sont pleins
+    size_t c = count_ >> CHUNK_BITS;
+    if (c == chunks_.size()) {
+        chunks_.push_back(std::make_unique<Chunk>());
+    }
+    Chunk& chunk = *chunks_[c];
+    size_t i = count_ & (CHUNK_SIZE - 1);
+    chunk.timestamp[i] = order.timestamp;
+    chunk.order_id[i] = order.order_id;
+    chunk.instrument[i] = order.instrument.id;
+    chunk.side[i] = order.side;
+    chunk.type[i] = order.type;
+    chunk.action[i] = order.action;
+    chunk.status[i] = status;
+    chunk.quantity[i] = order.quantity;
+    chunk.price[i] = order.price;
+    chunk.executed_quantity[i] = executed_quantity;
+    chunk.execution_price[i] = execution_price;
+    chunk.counterparty_id[i] = counterparty_id;
+    count_++;
+}
+
+void ResultTable::append(const OrderResult& result) {
+    append(result.original_order, result.status, result.executed_quantity, result.execution_price,
+           result.counterparty_id);
+}
+
+OrderResult ResultTable::operator[](size_t index) const {
+    const Chunk& chunk = chunkOf(index);
+    size_t i = index & (CHUNK_SIZE - 1);
+    OrderResult result(Order{chunk.timestamp[i], chunk.order_id[i], Instrument::fromId(chunk.instrument[i]),
+                             chunk.side[i], chunk.type[i], chunk.quantity[i], chunk.price[i], chunk.action[i]});
+    result.status = chunk.status[i];
+    result.executed_quantity = chunk.executed_quantity[i];
+    result.execution_price = chunk.execution_price[i];
+    result.counterparty_id = chunk.counterparty_id[i];
+    return result;
+}
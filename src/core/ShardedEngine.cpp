@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <iterator>
+#include "core/ShardedEngine.h"
+#include "utils/Logger.h"
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Constructeur : création des shards et démarrage de leurs threads
+ShardedEngine::ShardedEngine(size_t shard_count, size_t queue_capacity, bool pin_threads)
+    : running(true), stopped(false) {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    if (shard_count == 0) {
+        shard_count = cores;
+    }
+    for (size_t i = 0; i < shard_count; i++) {
+        shards.push_back(std::make_unique<Shard>(queue_capacity));
+    }
+    for (size_t i = 0; i < shard_count; i++) {
+        Shard& shard = *shards[i];
+        shard.thread = std::thread(&ShardedEngine::run, this, std::ref(shard));
+#ifdef __linux__
+        // Épinglage du thread du shard sur un coeur (les shards se répartissent les coeurs à tour de rôle)
+        if (pin_threads) {
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            CPU_SET(i % cores, &cpu_set);
+            if (pthread_setaffinity_np(shard.thread.native_handle(), sizeof(cpu_set), &cpu_set) != 0) {
+                LOG_WARN("Impossible d'épingler le shard ", i, " sur le coeur ", i % cores);
+            }
+        }
+#else
+        (void)pin_threads;
+#endif
+    }
+}
+
+// Destructeur
+ShardedEngine::~ShardedEngine() {
+    stop();
+}
+
+size_t ShardedEngine::shardOf(Instrument instrument) const {
+    // Les IDs d'instrument sont denses (dans l'ordre d'apparition) : le modulo répartit les instruments
+    // à tour de rôle entre les shards, de façon stable pour un même flux
+    return instrument.id % shards.size();
+}
+
+void ShardedEngine::submit(const Order& order) {
+    Shard& shard = *shards[shardOf(order.instrument)];
+    unsigned idle_rounds = 0;
+    while (!shard.input.tryPush(order)) {
+        waitBackoff(idle_rounds);
+    }
+}
+
+size_t ShardedEngine::pollResults(std::vector<OrderResult>& out) {
+    // stopped est lu avant de vider les files : s'il vaut true, plus aucun shard ne pousse de résultat et le
+    // backlog vient après tout ce qui est en file. Sinon, un shard peut encore pousser puis s'arrêter pendant
+    // ce parcours : son backlog n'est pris qu'à l'appel suivant, une fois sa file vidée (ordre des résultats)
+    bool shards_stopped = stopped.load(std::memory_order_acquire);
+    size_t count = 0;
+    OrderResult result;
+    for (auto& shard : shards) {
+        while (shard->output.tryPop(result)) {
+            out.push_back(std::move(result));
+            count++;
+        }
+        // Une fois les threads arrêtés, on récupère aussi ce qui n'a pas pu passer dans la file de sortie
+        if (shards_stopped) {
+            count += shard->backlog.size() - shard->backlog_pos;
+            out.insert(out.end(), std::make_move_iterator(shard->backlog.begin() + shard->backlog_pos),
+                       std::make_move_iterator(shard->backlog.end()));
+            shard->backlog.clear();
+            shard->backlog_pos = 0;
+        }
+    }
+    return count;
+}
+
+void ShardedEngine::stop() {
+    if (stopped.load(std::memory_order_acquire)) {
+        return;
+    }
+    running.store(false, std::memory_order_release);
+    for (auto& shard : shards) {
+        shard->thread.join();
+    }
+    // Publication après les joins : le collecteur qui lit stopped à true voit les backlogs définitifs
+    stopped.store(true, std::memory_order_release);
+}
+
+void ShardedEngine::run(Shard& shard) {
+    // ################################################################################################
+    // Boucle d'un shard : on prend les ordres de la file d'entrée un par un, on les passe à l'engine de
+    // leur instrument, puis on pousse ses résultats vers la file de sortie (le surplus attend dans le backlog).
+    // Tant que le backlog n'est pas vide, on ne prend plus d'ordre (contre-pression), sauf après stop().
+    // Le shard s'arrête quand le routeur a fini (stop) et que sa file d'entrée est vide.
+    // ################################################################################################
+    Order order;
+    unsigned idle_rounds = 0;
+    while (true) {
+        bool accepting = shard.backlog.empty() || !running.load(std::memory_order_acquire);
+        if (accepting && shard.input.tryPop(order)) {
+            idle_rounds = 0;
+            if (order.instrument.id >= shard.engines.size()) {
+                shard.engines.resize(order.instrument.id + 1);
+            }
+            std::unique_ptr<MatchingEngine>& slot = shard.engines[order.instrument.id];
+            if (!slot) {
+                slot = std::make_unique<MatchingEngine>();
+            }
+            MatchingEngine& engine = *slot;
+            engine.processOrder(order);
+            engine.drainResults(shard.backlog);
+            flushBacklog(shard);
+            continue;
+        }
+
+        flushBacklog(shard);
+        if (!running.load(std::memory_order_acquire) && shard.input.empty()) {
+            break;
+        }
+        waitBackoff(idle_rounds);
+    }
+}
+
+void ShardedEngine::flushBacklog(Shard& shard) {
+    while (shard.backlog_pos < shard.backlog.size() && shard.output.tryPush(std::move(shard.backlog[shard.backlog_pos]))) {
+        shard.backlog_pos++;
+    }
+    // Backlog entièrement transmis : on le vide (sa capacité est conservée)
+    if (shard.backlog_pos == shard.backlog.size()) {
+        shard.backlog.clear();
+        shard.backlog_pos = 0;
+    }
+}
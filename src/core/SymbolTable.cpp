@@ -0,0 +1,103 @@
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "core/SymbolTable.h"
+#include "utils/Logger.h"
+
+namespace {
+    // Entrées stockées par blocs de taille fixe, jamais déplacés : une entrée reste à la même adresse
+    // et peut être lue sans verrou pendant que d'autres instruments sont enregistrés
+    constexpr size_t BLOCK_BITS = 10;
+    constexpr size_t BLOCK_SIZE = size_t(1) << BLOCK_BITS;
+    constexpr size_t MAX_BLOCKS = SYMBOL_TABLE_CAPACITY / BLOCK_SIZE;    // jusqu'à 4 millions d'instruments
+
+    struct SymbolEntry {
+        std::string name;
+        TickSize tick;
+    };
+
+    struct SymbolStore {
+        std::mutex mutex;
+        std::map<std::string, InstrumentId, std::less<>> ids;
+        std::unique_ptr<SymbolEntry[]> blocks[MAX_BLOCKS];
+        std::atomic<size_t> count{0};
+    };
+
+    // Table statique (initialisée au premier appel)
+    SymbolStore& store() {
+        static SymbolStore symbols;
+        return symbols;
+    }
+
+    const std::string& emptyName() {
+        static const std::string empty;
+        return empty;
+    }
+
+    // Création de l'entrée d'un ID (appelé sous verrou, avec id == symbols.count), publiée en dernier
+    void addEntry(SymbolStore& symbols, size_t id, std::string_view name) {
+        std::unique_ptr<SymbolEntry[]>& block = symbols.blocks[id >> BLOCK_BITS];
+        if (!block) {
+            block.reset(new SymbolEntry[BLOCK_SIZE]);
+        }
+        SymbolEntry& entry = block[id & (BLOCK_SIZE - 1)];
+        entry.name.assign(name);
+        entry.tick = TickTable::get(name);
+        symbols.count.store(id + 1, std::memory_order_release);
+    }
+}
+
+InstrumentId SymbolTable::intern(std::string_view name) {
+    SymbolStore& symbols = store();
+    std::lock_guard<std::mutex> lock(symbols.mutex);
+    auto it = symbols.ids.find(name);
+    if (it != symbols.ids.end()) {
+        return it->second;
+    }
+
+    // Table pleine : le nom est refusé. L'entrée réservée (UNKNOWN_INSTRUMENT, hors du dictionnaire des noms)
+    // est créée au premier refus, pour que les ordres rejetés aient un ID affichable comme les autres.
+    size_t id = symbols.count.load(std::memory_order_relaxed);
+    if (id >= OVERFLOW_INSTRUMENT_ID) {
+        LOG_ERROR("Table des symboles pleine : instrument refusé, remplacé par ", UNKNOWN_INSTRUMENT, " : ", name);
+        if (id == OVERFLOW_INSTRUMENT_ID) {
+            addEntry(symbols, id, UNKNOWN_INSTRUMENT);
+        }
+        return OVERFLOW_INSTRUMENT_ID;
+    }
+
+    // Nouvel instrument : entrée créée puis publiée (le compteur est incrémenté en dernier)
+    addEntry(symbols, id, name);
+    symbols.ids.emplace(symbols.blocks[id >> BLOCK_BITS][id & (BLOCK_SIZE - 1)].name, static_cast<InstrumentId>(id));
+    return static_cast<InstrumentId>(id);
+}
+
+const std::string& SymbolTable::name(InstrumentId id) {
+    SymbolStore& symbols = store();
+    if (id >= symbols.count.load(std::memory_order_acquire)) {
+        return emptyName();
+    }
+    return symbols.blocks[id >> BLOCK_BITS][id & (BLOCK_SIZE - 1)].name;
+}
+
+TickSize SymbolTable::tick(InstrumentId id) {
+    SymbolStore& symbols = store();
+    if (id >= symbols.count.load(std::memory_order_acquire)) {
+        return DEFAULT_TICK_SIZE;
+    }
+    return symbols.blocks[id >> BLOCK_BITS][id & (BLOCK_SIZE - 1)].tick;
+}
+
+size_t SymbolTable::size() {
+    return store().count.load(std::memory_order_acquire);
+}
+
+void SymbolTable::updateTick(std::string_view name, TickSize tick) {
+    SymbolStore& symbols = store();
+    std::lock_guard<std::mutex> lock(symbols.mutex);
+    auto it = symbols.ids.find(name);
+    if (it != symbols.ids.end()) {
+        symbols.blocks[it->second >> BLOCK_BITS][it->second & (BLOCK_SIZE - 1)].tick = tick;
+    }
+}
@@ -1,82 +1,375 @@
 #include <iostream>
-#include <sstream>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include "data/CSVReader.h"
+#include "data/OrderColumns.h"
+#include "utils/Logger.h"
+#include "utils/MappedFile.h"
+
+// ################################################################################################
+// Libellés bruts (côté / action inconnus d'une ligne BAD_INPUT)
+// Ils sont rares : un simple tableau protégé par un mutex suffit. Le deque garantit que les libellés
+// déjà enregistrés ne sont jamais déplacés (les pointeurs renvoyés par toLabel restent valides).
+// ################################################################################################
+namespace {
+    std::deque<std::string>& rawLabelStore() {
+        static std::deque<std::string> labels;
+        return labels;
+    }
+    std::mutex& rawLabelMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+    const std::string& unknownRawLabel() {
+        static const std::string unknown(UNKNOWN_RAW_LABEL);
+        return unknown;
+    }
+}
+
+uint8_t RawLabels::intern(std::string_view label) {
+    std::lock_guard<std::mutex> lock(rawLabelMutex());
+    std::deque<std::string>& labels = rawLabelStore();
+    for (size_t i = 0; i < labels.size(); i++) {
+        if (labels[i] == label) {
+            return static_cast<uint8_t>(FIRST_RAW_LABEL + i);
+        }
+    }
+    // Au-delà de la capacité du code sur un octet (OVERFLOW_RAW_LABEL est réservé), le libellé est refusé :
+    // on ne renvoie jamais le code d'un autre libellé
+    if (FIRST_RAW_LABEL + labels.size() >= OVERFLOW_RAW_LABEL) {
+        LOG_ERROR("Table des libellés bruts pleine : libellé remplacé par ", UNKNOWN_RAW_LABEL, " : ", label);
+        return OVERFLOW_RAW_LABEL;
+    }
+    labels.emplace_back(label);
+    return static_cast<uint8_t>(FIRST_RAW_LABEL + labels.size() - 1);
+}
+
+bool RawLabels::contains(uint8_t code) {
+    std::lock_guard<std::mutex> lock(rawLabelMutex());
+    return code >= FIRST_RAW_LABEL && static_cast<size_t>(code - FIRST_RAW_LABEL) < rawLabelStore().size();
+}
+
+const std::string& RawLabels::get(uint8_t code) {
+    std::lock_guard<std::mutex> lock(rawLabelMutex());
+    const std::deque<std::string>& labels = rawLabelStore();
+    if (code < FIRST_RAW_LABEL || static_cast<size_t>(code - FIRST_RAW_LABEL) >= labels.size()) {
+        return unknownRawLabel();
+    }
+    return labels[code - FIRST_RAW_LABEL];
+}
+
+// Conversion texte -> code sans contrôle (libellé inconnu -> libellé brut)
+Side parseSide(std::string_view label) {
+    if (label == "BUY") return Side::BUY;
+    if (label == "SELL") return Side::SELL;
+    return static_cast<Side>(RawLabels::intern(label));
+}
+
+Action parseAction(std::string_view label) {
+    if (label == "NEW") return Action::NEW;
+    if (label == "MODIFY") return Action::MODIFY;
+    if (label == "CANCEL") return Action::CANCEL;
+    return static_cast<Action>(RawLabels::intern(label));
+}
+
+// Conversion code -> texte
+const char* toLabel(Side side) {
+    switch (side) {
+        case Side::BUY: return "BUY";
+        case Side::SELL: return "SELL";
+    }
+    return RawLabels::get(static_cast<uint8_t>(side)).c_str();
+}
+
+const char* toLabel(OrderType type) {
+    switch (type) {
+        case OrderType::LIMIT: return "LIMIT";
+        case OrderType::MARKET: return "MARKET";
+        case OrderType::BAD_INPUT: return "BAD_INPUT";
+    }
+    return "BAD_INPUT";
+}
+
+const char* toLabel(Action action) {
+    switch (action) {
+        case Action::NEW: return "NEW";
+        case Action::MODIFY: return "MODIFY";
+        case Action::CANCEL: return "CANCEL";
+    }
+    return RawLabels::get(static_cast<uint8_t>(action)).c_str();
+}
+
+const char* toLabel(OrderStatus status) {
+    switch (status) {
+        case OrderStatus::PENDING: return "PENDING";
+        case OrderStatus::EXECUTED: return "EXECUTED";
+        case OrderStatus::PARTIALLY_EXECUTED: return "PARTIALLY_EXECUTED";
+        case OrderStatus::CANCELED: return "CANCELED";
+        case OrderStatus::REJECTED: return "REJECTED";
+    }
+    return "REJECTED";
+}
+
+// ################################################################################################
+// Le fichier est accédé par projection mémoire (MappedFile) : il est lu directement dans le cache
+// du noyau, sans copie dans un buffer de flux, et découpé en champs sous forme de string_view.
+// ################################################################################################
+namespace {
+    // Découpage d'une ligne en champs séparés par des virgules (au plus CSV_FIELD_COUNT, les suivants sont ignorés).
+    // Même règle que getline(..., ',') : une virgule finale n'ouvre pas de champ vide.
+    size_t splitFields(std::string_view line, CsvRow& fields) {
+        size_t count = 0;
+        size_t start = 0;
+        while (start < line.size() && count < fields.size()) {
+            size_t comma = line.find(',', start);
+            if (comma == std::string_view::npos) {
+                fields[count++] = line.substr(start);
+                break;
+            }
+            fields[count++] = line.substr(start, comma - start);
+            start = comma + 1;
+        }
+        return count;
+    }
+
+    // Parcours des lignes d'un texte : callback(const CsvRow&) pour chaque ligne complète
+    // (header : la première ligne est la ligne de titre, ignorée)
+    template <typename Callback>
+    void forEachLine(const char* data, size_t size, bool header, Callback&& callback) {
+        // row contiendra les champs de la ligne (vues sur le texte, passage CSV -> C++)
+        CsvRow row;
+        size_t pos = 0;
+
+        // Boucle sur les lignes, tant qu'il reste des caractères
+        while (pos < size) {
+            const void* newline = std::memchr(data + pos, '\n', size - pos);
+            size_t end = (newline == nullptr) ? size : static_cast<size_t>(static_cast<const char*>(newline) - data);
+            std::string_view line(data + pos, end - pos);
+            pos = end + 1;
+
+            // On ignore la ligne de titre (première ligne du fichier)
+            if (header) {
+                header = false;
+                LOG_DEBUG("Header ignoré: ", line);
+                continue;
+            }
+
+            // Vérification
+            if (splitFields(line, row) < CSV_FIELD_COUNT) {
+                LOG_WARN("Ligne incomplète ignorée : ", line);
+                continue;
+            }
+            callback(row);
+        }
+    }
+
+    // Estimation du nombre de lignes du fichier à partir de sa taille et de la longueur moyenne
+    // des premières lignes (pour réserver le vecteur des ordres en une seule allocation)
+    size_t estimateLineCount(const char* data, size_t size) {
+        const size_t SAMPLE_LINES = 64;
+        size_t lines = 0;
+        size_t pos = 0;
+        while (pos < size && lines < SAMPLE_LINES) {
+            const void* newline = std::memchr(data + pos, '\n', size - pos);
+            pos = (newline == nullptr) ? size : static_cast<size_t>(static_cast<const char*>(newline) - data) + 1;
+            lines++;
+        }
+        if (pos == 0) {
+            return 0;
+        }
+        return size / (pos / lines) + 1;
+    }
+
+    // Lecture d'un entier en tête de texte, avec la même tolérance que std::stoll / std::stoi :
+    // espaces ignorés en tête, signe optionnel, lecture jusqu'au premier caractère non numérique.
+    // Renvoie false si aucun chiffre n'a été lu ou si la valeur ne tient pas dans le type demandé.
+    template <typename T>
+    bool parseLeadingInteger(std::string_view text, T& value) {
+        size_t pos = 0;
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            pos++;
+        }
+        if (pos < text.size() && text[pos] == '+') {
+            pos++;
+            if (pos < text.size() && text[pos] == '-') {
+                return false;
+            }
+        }
+        std::from_chars_result result = std::from_chars(text.data() + pos, text.data() + text.size(), value);
+        return result.ec == std::errc();
+    }
+}
+
 // Constructeur avec nom du fichier dans filename
-CsvReader::CsvReader(std::string filename):file_(filename){
+CsvReader::CsvReader(std::string filename):filename_(std::move(filename)){
 }
 
 // Constructeur sans nom de fichier
 CsvReader::CsvReader(){
-    std::cout << "Initialisation du CSV Reader" << std::endl;
+    LOG_DEBUG("Initialisation du CSV Reader");
 }
 
 // Destructeur
 CsvReader::~CsvReader() {
-    std::cout << "Destruction du CSV reader" << std::endl;
+    LOG_DEBUG("Destruction du CSV reader");
+}
+
+// Parcours des lignes de données du fichier (hors ligne de titre et lignes incomplètes)
+// (reserve_orders : réserve le tableau des ordres d'après la taille du fichier)
+template <typename Callback>
+bool CsvReader::forEachRow(bool reserve_orders, Callback&& callback) {
+    // ################################################################################################
+    // Le fichier est projeté en mémoire puis parcouru ligne par ligne : chaque ligne et chaque champ
+    // sont des string_view sur le fichier (aucune copie, aucune allocation par ligne).
+    // L'instrument n'est pas copié : son nom est enregistré une fois dans la table des symboles.
+    // ################################################################################################
+    MappedFile file(filename_);
+    if (file.data() == nullptr) {
+        LOG_WARN("Fichier vide ou introuvable : ", filename_);
+        return false;
+    }
+    const char* data = file.data();
+    size_t size = file.size();
+
+    // Réservation du vecteur des ordres d'après la taille du fichier
+    if (reserve_orders) {
+        orders.reserve(orders.size() + estimateLineCount(data, size));
+    }
+
+    forEachLine(data, size, true, callback);
+    return true;
 }
 
 void CsvReader::init(){
-    // line contiendra chaque ligne du fichier, word contiendra chaque mot extrait de la ligne
-    std::string line, word;
-    // row sera le vecteur qui contiendra les mots de la ligne (passage CSV -> C++)
-    std::vector<std::string> row;
-    
-    // On ignore la ligne de titre (le curseur au départ est nécessairement sur la première ligne)
-    if (std::getline(file_, line)) {
-        std::cout << "Header ignoré: " << line << std::endl;
+    // Fichier déjà converti en colonnes (build/tools/csv_to_columns) : chargement sans parsing
+    if (OrderColumnsFile::isColumnFile(filename_)) {
+        loadColumns();
+        return;
     }
-    
-    // Boucle sur les lignes, tant qu'il y a une nouvelle ligne
-    while (std::getline(file_, line)) {
-        row.clear();
-        
-        // Transformation de la ligne en un "flux" qu'on pourra séparer par les virgules
-        std::stringstream s(line);
-        
-        // Boucle sur les éléments de la ligne
-        while(getline(s, word, ',')){
-            // Ajout du mot au vecteur row
-            row.push_back(word);
+
+    forEachRow(true, [this](const CsvRow& row) {
+        // Création de l'ordre (instance de "Order" dans notre code) et ajout au vecteur des ordres
+        Order order = testOrder(row);
+        uint32_t index = static_cast<uint32_t>(orders.size());
+        orders.push_back(order);
+
+        // Ajout de l'indice de l'ordre à la liste de son actif (une liste par actif différent)
+        indexOrder(index);
+    });
+    LOG_INFO("Chargement de ", orders.size(), " ordres avec succès!");
+}
+
+void CsvReader::loadColumns(){
+    OrderColumnsFile columns(filename_);
+    if (!columns.isValid()) {
+        LOG_ERROR("Aucun ordre chargé depuis le fichier en colonnes ", filename_);
+        return;
+    }
+    uint32_t first_index = static_cast<uint32_t>(orders.size());
+    columns.appendOrders(orders);
+
+    // Listes d'indices par actif (les ordres portent déjà l'ID de leur instrument)
+    for (uint32_t index = first_index; index < orders.size(); index++) {
+        indexOrder(index);
+    }
+    LOG_INFO("Chargement de ", orders.size(), " ordres avec succès!");
+}
+
+size_t CsvReader::readBatches(size_t batch_size, const std::function<void(std::vector<Order>&)>& on_batch) {
+    // Les ordres ne sont pas conservés par le reader : seul le lot en cours existe
+    size_t count = 0;
+    std::vector<Order> batch;
+    batch.reserve(batch_size);
+    forEachRow(false, [&](const CsvRow& row) {
+        batch.push_back(testOrder(row));
+        if (batch.size() == batch_size) {
+            count += batch.size();
+            on_batch(batch);
+            batch.clear();
+            batch.reserve(batch_size);
         }
-        
-        // Vérification
-        if (row.size() < 8) {
-            std::cout << "Ligne incomplète ignorée" << std::endl;
-            continue;
+    });
+    if (!batch.empty()) {
+        count += batch.size();
+        on_batch(batch);
+    }
+    LOG_INFO("Lecture de ", count, " ordres par lots avec succès!");
+    return count;
+}
+
+size_t CsvReader::readLineBatches(size_t batch_size, const std::function<void(std::string&)>& on_batch) {
+    // Aucune validation : on ne cherche que les fins de ligne, chaque lot est une copie d'un bloc du fichier
+    MappedFile file(filename_);
+    if (file.data() == nullptr) {
+        LOG_WARN("Fichier vide ou introuvable : ", filename_);
+        return 0;
+    }
+    const char* data = file.data();
+    size_t size = file.size();
+
+    // Ligne de titre ignorée
+    const void* newline = std::memchr(data, '\n', size);
+    size_t pos = (newline == nullptr) ? size : static_cast<size_t>(static_cast<const char*>(newline) - data) + 1;
+
+    size_t count = 0;
+    std::string batch;
+    while (pos < size) {
+        size_t start = pos;
+        size_t lines = 0;
+        while (pos < size && lines < batch_size) {
+            newline = std::memchr(data + pos, '\n', size - pos);
+            pos = (newline == nullptr) ? size : static_cast<size_t>(static_cast<const char*>(newline) - data) + 1;
+            lines++;
         }
-        
-        // Création de l'ordre (instance de "Order" dans notre code)
-        Order order;
-        order = testOrder(row);
-        
-        // Ajout de l'ordre au vecteur des ordres
-        orders.push_back(order);
+        count += lines;
+        batch.assign(data + start, pos - start);
+        on_batch(batch);
+    }
+    return count;
+}
 
-        // Ajout de l'ordre à la map : une clé par actif différent (==> un vecteur d'ordre par actif)
-        // Vérification que si le ticker est déjà sélectionné 
-        auto it = map_orders_asset.find(order.instrument);
+void CsvReader::parseLines(std::string_view lines, std::vector<Order>& out) {
+    forEachLine(lines.data(), lines.size(), false, [this, &out](const CsvRow& row) {
+        out.push_back(testOrder(row));
+    });
+}
 
-        // Si l'actif est déjà dans le mapping, on ajoute l'ordre
-        if(it != map_orders_asset.end()){
-            it->second.push_back(order);
-        // Sinon, on crée le couple clé/valeur
-        }else{
-            std::cout << "Instrument non trouvé" << std::endl;
-            // Etape 1 : création d'un vecteur pour stocker les ordres de l'actif
-            std::vector<Order> orders_asset;
+void CsvReader::indexOrder(uint32_t index) {
+    InstrumentId id = orders[index].instrument.id;
+    if (id >= instrument_indices.size()) {
+        LOG_DEBUG("Nouvel instrument : ", orders[index].instrument.name());
+        instrument_indices.resize(id + 1);
+    }
+    instrument_indices[id].push_back(index);
+}
 
-            // Etape 2 : création du couple clé/valeur
-            map_orders_asset[order.instrument] = orders_asset;
+// Vues par actif : construites à partir des listes d'indices (seules les clés sont copiées)
+std::map<std::string, OrderView> CsvReader::getMapOrder() const {
+    std::map<std::string, OrderView> views;
+    for (const auto& [instrument, view] : getInstrumentViews()) {
+        views.emplace(instrument.name(), view);
+    }
+    return views;
+}
 
-            // Etape 3 : Récupération de l'ordre
-            map_orders_asset[order.instrument].push_back(order);
+std::vector<std::pair<Instrument, OrderView>> CsvReader::getInstrumentViews() const {
+    std::vector<std::pair<Instrument, OrderView>> views;
+    for (size_t id = 0; id < instrument_indices.size(); id++) {
+        if (!instrument_indices[id].empty()) {
+            views.emplace_back(Instrument::fromId(static_cast<InstrumentId>(id)), OrderView(orders, instrument_indices[id]));
         }
     }
-    std::cout << "Chargement de " << orders.size() << " ordres avec succès!" << std::endl;
+    return views;
 }
+
 // Méthode permettant d'afficher le contenu d'un vecteur d'ordre
 void CsvReader::Display(){
+    LOG_FLUSH();
 
     std::cout << "Timestamp - ID - Instrument - Side - Type - Quantité - Prix - Action" << std::endl;
 
@@ -84,177 +377,224 @@ void CsvReader::Display(){
     for(u_long i = 0; i < orders.size(); i++){
         // On récupère l'ordre et on affiche ses caractéristiques
         Order order = orders[i];
-        std::cout << order.timestamp << " " << order.order_id << " " << order.instrument << " " << order.side << " " << order.type << " " << order.quantity << " " << order.price << " " << order.action << std::endl;
+        std::cout << order.timestamp << " " << order.order_id << " " << order.instrument << " " << order.side << " " << order.type << " " << order.quantity << " " << priceToDouble(order.price, order.instrument.tick()) << " " << order.action << std::endl;
     };
 }
 
 // Méthode permettant de tester le contenu d'un ordre
-Order CsvReader::testOrder(std::vector<std::string> row){
+// Chaque champ est validé dans l'ordre des colonnes ; à la première erreur on arrête et l'ordre devient BAD_INPUT.
+// Aucune exception n'est levée : une ligne invalide coûte autant qu'une ligne valide.
+Order CsvReader::testOrder(const CsvRow& row){
    
     Order order;
-    bool hasError = false;
-    bool hasErrorTS = false;
- 
-    try{
-        // Récupération des paramètres
-        order.timestamp = testTimestamp(row[0]);
- 
-    }catch(std::runtime_error& error_ts){
-        hasErrorTS = true;
-        hasError = true;
+
+    // Le timestamp est conservé même si le reste de la ligne est invalide (0 s'il est lui-même invalide)
+    ParseError error = testTimestamp(row[0], order.timestamp);
+    if (error != ParseError::NONE) {
         order.timestamp = 0;
     }
 
-    try{
-        order.order_id = testId(row[1]);        
-        order.instrument = row[2];
-        order.side = testSide(row[3]);
-        order.type = testType(row[4]);
-        order.quantity = testQuantity(row[5]);
-        order.price = testPrice(row[6], row[4]);            
-        order.action = testAction(row[7]);
-    }catch(std::runtime_error& error){
-        hasError = true;
+    ParseError field_error = testId(row[1], order.order_id);
+    if (field_error == ParseError::NONE) {
+        // Nom refusé par une table des symboles pleine (erreur déjà signalée) : l'ordre est rejeté
+        order.instrument = Instrument(row[2]);
+        field_error = order.instrument.isValid() ? testSide(row[3], order.side) : ParseError::BAD_INSTRUMENT;
+    }
+    if (field_error == ParseError::NONE) {
+        field_error = testType(row[4], order.type);
+    }
+    if (field_error == ParseError::NONE) {
+        field_error = testQuantity(row[5], order.quantity);
+    }
+    if (field_error == ParseError::NONE) {
+        field_error = testPrice(row[6], order.type, order.instrument, order.price);
+    }
+    if (field_error == ParseError::NONE) {
+        field_error = testAction(row[7], order.action);
+    }
+    if (error == ParseError::NONE) {
+        error = field_error;
     }
    
     // En cas d'erreur, on modifie le type de l'ordre en BAD_INPUT pour le rejeter automatiquement par la suite
-    if (hasError) {
-        if(hasErrorTS == false){
-            order.timestamp = testTimestamp(row[0]);
-        }
+    if (error != ParseError::NONE) {
         order.order_id = 0;
-        order.instrument = row[2];
-        order.side = row[3];
-        order.type = "BAD_INPUT";  
+        if (order.instrument.id == INVALID_INSTRUMENT_ID) {
+            order.instrument = Instrument(row[2]);
+        }
+        order.side = parseSide(row[3]);
+        order.type = OrderType::BAD_INPUT;  
         order.quantity = 0;  
         order.price = 0;    
-        order.action = row[7];
+        order.action = parseAction(row[7]);
     }
    
     return(order);
 }
+
 // Méthode permettant de tester la récupération d'un timestamp
-long long CsvReader::testTimestamp(std::string rowValue){
+ParseError CsvReader::testTimestamp(std::string_view rowValue, long long& timestamp){
 
-    long long timestamp;
-    // Vérification que la conversion en long long est possible
-    try{
-        timestamp = std::stoll(rowValue);
-    }catch (long long error){
-        std::cout << error << std::endl;
-        throw std::runtime_error("Problème dans la conversion du timestamp");
-    }catch(std::invalid_argument error){
-        throw std::runtime_error("Problème dans la conversion du timestamp");
+    // Vérification que la conversion en long long est possible (lecture directe dans le fichier)
+    if(!parseLeadingInteger(rowValue, timestamp)){
+        LOG_DEBUG("Timestamp invalide : ", rowValue);
+        return ParseError::BAD_TIMESTAMP;
     }
 
     // Si le test est passé, vérification que le timestamp ne soit pas négatif
     if(timestamp < 0){
-        throw std::runtime_error("Un timestamp ne peut pas être négatif");
+        LOG_DEBUG("Un timestamp ne peut pas être négatif : ", rowValue);
+        return ParseError::BAD_TIMESTAMP;
     }
-
-    // Récupération du timestamp
-    return(timestamp);
+    return ParseError::NONE;
 }
 
 // Méthode permettant de tester la récupération de l'ID
-int CsvReader::testId(std::string rowValue){
+ParseError CsvReader::testId(std::string_view rowValue, int& id){
 
-    // Test pour la conversion en int
-    int id; 
-    try{
-        id = std::stoi(rowValue);
-    }catch(int error){
-        std::cout << error << std::endl;
-        throw std::runtime_error("Problème sur la valeur de l'ID");
-    }catch(std::invalid_argument error){
-        throw std::runtime_error("Problème dans la conversion de l'ID");
+    // Test pour la conversion en int (valeur hors de l'intervalle d'un int comprise)
+    if(!parseLeadingInteger(rowValue, id)){
+        LOG_DEBUG("ID invalide : ", rowValue);
+        return ParseError::BAD_ID;
     }
 
-    // Vérification que  l'ID est positif
+    // Vérification que l'ID est positif
     if(id <= 0){
-        std::cout << id << std::endl;
-        std::runtime_error("L'id doit être positif");
+        LOG_DEBUG("L'id doit être positif : ", rowValue);
+        return ParseError::BAD_ID;
     }
-
-    // Si les tests sont passés, récupération de l'ID
-    return(id);
+    return ParseError::NONE;
 }
 
 // Méthode permettant de tester la récupération du side
-std::string CsvReader::testSide(std::string rowValue){
-    std::string side = rowValue;
-    if(side != "BUY" && side != "SELL"){
-        std::cout << side << std::endl;
-        throw std::runtime_error("L'ordre doit être un ordre d'achat (BUY) ou de vente (SELL)");
+ParseError CsvReader::testSide(std::string_view rowValue, Side& side){
+    if(rowValue == "BUY"){
+        side = Side::BUY;
+        return ParseError::NONE;
+    }else if(rowValue == "SELL"){
+        side = Side::SELL;
+        return ParseError::NONE;
     }
-
-    // Récupération
-    return(side);
+    LOG_DEBUG("L'ordre doit être un ordre d'achat (BUY) ou de vente (SELL) : ", rowValue);
+    return ParseError::BAD_SIDE;
 }
 
 // Méthode permettant de tester le type d'ordre
-std::string CsvReader::testType(std::string rowValue){
-    std::string type;
+ParseError CsvReader::testType(std::string_view rowValue, OrderType& type){
 
     // Vérification du type d'ordre : seul limite et marché sont implémentés
     if(rowValue == "LIMIT"){
-        type = rowValue;
+        type = OrderType::LIMIT;
+        return ParseError::NONE;
     }else if(rowValue == "MARKET"){
-        type = rowValue;
-    }else{
-        throw std::runtime_error("Seuls les ordres à cours limité / au marché sont implémentés");
+        type = OrderType::MARKET;
+        return ParseError::NONE;
     }
-
-    // Récupération du type d'ordre
-    return(type);
+    LOG_DEBUG("Seuls les ordres à cours limité / au marché sont implémentés : ", rowValue);
+    return ParseError::BAD_TYPE;
 }
 
 // Méthode permettant de tester la quantité
-int CsvReader::testQuantity(std::string rowValue){
-    int quantity;
+ParseError CsvReader::testQuantity(std::string_view rowValue, int& quantity){
+
     // Vérification que l'on peut convertir la quantité
-    try{
-        quantity = std::stoi(rowValue);
-    }catch(int error){
-        std::cout << rowValue << std::endl;
-        throw std::runtime_error("Problème dans la conversion de la quantité");
-    }catch(std::invalid_argument error){
-        throw std::runtime_error("Problème dans la conversion de la quantité");
+    if(!parseLeadingInteger(rowValue, quantity)){
+        LOG_DEBUG("Quantité invalide : ", rowValue);
+        return ParseError::BAD_QUANTITY;
     }
 
     // Si la conversion a bien eu lieu, on vérifie qu'elle est positive
     if(quantity <= 0){
-        std::cout << quantity << std::endl;
-        throw std::runtime_error("La quantité ne peut pas être négative ou nulle");
+        LOG_DEBUG("La quantité ne peut pas être négative ou nulle : ", rowValue);
+        return ParseError::BAD_QUANTITY;
     }
-
-    // Si les tests sont passés, on récupère la quantité
-    return(quantity);
+    return ParseError::NONE;
 }
 
 // Méthode permettant de tester le prix
-float CsvReader::testPrice(std::string rowValue, std::string orderType){
+// Le texte est converti directement en nombre entier de ticks, sans passer par un float :
+// on lit la partie entière et les décimales chiffre par chiffre à l'échelle 10^-decimals du tick,
+// puis on arrondit au tick le plus proche (les chiffres au-delà de la précision servent à l'arrondi).
+ParseError CsvReader::testPrice(std::string_view rowValue, OrderType orderType, Instrument instrument, Price& price){
 
-    std::string LIMIT_LABEL = "LIMIT";
-    std::string MARKET_LABEL = "MARKET";
-    float price;
     // Deux cas à tester : ordre à cours limité et ordre au marché (tous les autres ordres auraient déjà provoqué une erreur)
-    if(orderType == LIMIT_LABEL){
-
-        // Vérification que la conversion est possible
-        try{
-            price = std::stof(rowValue);
-        }catch(float error){
-            std::cout << error << std::endl;
-            throw std::runtime_error("Problème dans la conversion du prix pour un ordre limite");
-        }catch(std::invalid_argument error){
-            throw std::runtime_error("Problème dans la conversion du prix d'un ordre");
+    if(orderType == OrderType::LIMIT){
+
+        TickSize tick = instrument.tick();
+        size_t pos = 0;
+
+        // Comme std::stof, on ignore les espaces en tête et on accepte un signe
+        while(pos < rowValue.size() && isspace(static_cast<unsigned char>(rowValue[pos]))){
+            pos++;
+        }
+        bool negative = false;
+        if(pos < rowValue.size() && (rowValue[pos] == '-' || rowValue[pos] == '+')){
+            negative = (rowValue[pos] == '-');
+            pos++;
+        }
+
+        // Lecture de la valeur à l'échelle 10^-decimals (ex : "150.25" -> 15025 pour 2 décimales)
+        const int64_t MAX_SCALED = INT64_MAX / 10;
+        int64_t scaled = 0;
+        int digits = 0;
+        int decimals_read = 0;
+        bool round_up = false;
+        bool in_decimals = false;
+        bool non_zero = false;
+        for(; pos < rowValue.size(); pos++){
+            char c = rowValue[pos];
+            if(c == '.' && !in_decimals){
+                in_decimals = true;
+                continue;
+            }
+            if(c < '0' || c > '9'){
+                break;
+            }
+            digits++;
+            non_zero = non_zero || (c != '0');
+            if(in_decimals && decimals_read >= tick.decimals){
+                // Premier chiffre au-delà de la précision : il décide de l'arrondi, les suivants sont ignorés
+                if(decimals_read == tick.decimals){
+                    round_up = (c >= '5');
+                }
+                decimals_read++;
+                continue;
+            }
+            if(scaled > MAX_SCALED){
+                LOG_DEBUG("Prix trop grand : ", rowValue);
+                return ParseError::BAD_PRICE;
+            }
+            scaled = scaled * 10 + (c - '0');
+            if(in_decimals){
+                decimals_read++;
+            }
+        }
+
+        // Vérification que la conversion est possible (au moins un chiffre)
+        if(digits == 0){
+            LOG_DEBUG("Prix invalide : ", rowValue);
+            return ParseError::BAD_PRICE;
         }
 
-        // Deuxième check : prix  > 0
-        if(price < 0){
-            std::cout << price << std::endl;
-            throw std::runtime_error("Le prix ne peut pas être négatif");
+        // Complément des décimales manquantes (ex : "150.3" -> 15030)
+        for(int i = decimals_read; i < tick.decimals; i++){
+            if(scaled > MAX_SCALED){
+                LOG_DEBUG("Prix trop grand : ", rowValue);
+                return ParseError::BAD_PRICE;
+            }
+            scaled *= 10;
+        }
+        if(round_up){
+            scaled++;
+        }
+
+        // Passage en ticks (arrondi au tick le plus proche)
+        price = (scaled + tick.units / 2) / tick.units;
+
+        // Deuxième check : prix >= 0 (comme avant, "-0" reste accepté)
+        if(negative && non_zero){
+            LOG_DEBUG("Le prix ne peut pas être négatif : ", rowValue);
+            return ParseError::BAD_PRICE;
         }
     }else{
 
@@ -262,19 +602,22 @@ float CsvReader::testPrice(std::string rowValue, std::string orderType){
         price = 0;
     }
     
-    // Récupération du prix
-    return(price);
+    return ParseError::NONE;
 }
 
 // Méthode permettant de tester le type d'action
-std::string CsvReader::testAction(std::string rowValue){
-
-    std::string action;
-    if(rowValue == "NEW" || rowValue == "MODIFY" || rowValue == "CANCEL"){
-        action = rowValue;
-    }else{
-        std::cout << rowValue << std::endl;
-        throw std::runtime_error("Les seules actions implémentées sont : NEW, MODIFY et CANCEL");
+ParseError CsvReader::testAction(std::string_view rowValue, Action& action){
+
+    if(rowValue == "NEW"){
+        action = Action::NEW;
+        return ParseError::NONE;
+    }else if(rowValue == "MODIFY"){
+        action = Action::MODIFY;
+        return ParseError::NONE;
+    }else if(rowValue == "CANCEL"){
+        action = Action::CANCEL;
+        return ParseError::NONE;
     }
-    return(action);
+    LOG_DEBUG("Les seules actions implémentées sont : NEW, MODIFY et CANCEL : ", rowValue);
+    return ParseError::BAD_ACTION;
 }
@@ -1,17 +1,18 @@
 #include <iostream>
+#include <fstream>
 #include <vector>
-#include <cmath>
-#include <sstream>  
-#include <iomanip>   
+#include <charconv>
+#include <cstdint>
 #include "data/CSVWriter.h"
+#include "utils/Logger.h"
 
 // Constructeur et destructeur par défaut
 CsvWriter::CsvWriter(){
-    std::cout << "Initialisation du CSV writer" << std::endl;
+    LOG_DEBUG("Initialisation du CSV writer");
 }
 
 CsvWriter::~CsvWriter(){
-    std::cout << "Destruction du CSV writer" << std::endl;
+    LOG_DEBUG("Destruction du CSV writer");
 }
 
 // Initialisation avec le nom du fichier à créer
@@ -19,70 +20,169 @@ CsvWriter::CsvWriter(std::string filename){
     CsvWriter::filename = filename;
 }
 
-std::string CsvWriter::formatPrice(float price) {
+namespace {
+    // Ajout d'un entier à la fin d'un buffer, sans chaîne intermédiaire
+    template <typename T>
+    void appendInteger(std::string& out, T value) {
+        char digits[24];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, result.ptr);
+    }
+}
+
+// Formatage d'un prix en ticks : valeur décimale exacte à la précision du tick,
+// sans les zéros inutiles ni le point s'il n'y a pas de décimale (ex : 15030 ticks de 0.01 -> "150.3")
+void CsvWriter::appendPrice(Price price, TickSize tick, std::string& out) {
     // Cas spécial pour 0
-    if (price == 0.0f) {
-        return "0";
+    if (price == 0) {
+        out += '0';
+        return;
+    }
+
+    // Valeur à l'échelle 10^-decimals, séparée en partie entière et décimales
+    int64_t scaled = price * tick.units;
+    if (scaled < 0) {
+        out += '-';
+        scaled = -scaled;
+    }
+    int64_t scale = 1;
+    for (int i = 0; i < tick.decimals; i++) {
+        scale *= 10;
+    }
+    appendInteger(out, scaled / scale);
+
+    // Décimales sur tick.decimals chiffres, sans les zéros finaux (aucune décimale : pas de point)
+    int64_t fraction = scaled % scale;
+    if (fraction == 0) {
+        return;
     }
-    
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2) << price;
-    std::string str = oss.str();
-    
-    // On supprime les zéros inutiles et le point si pas de décimale
-    str.erase(str.find_last_not_of('0') + 1, std::string::npos);
-    str.erase(str.find_last_not_of('.') + 1, std::string::npos);
-    
-    return str;
+    int digit_count = tick.decimals;
+    while (fraction % 10 == 0) {
+        fraction /= 10;
+        digit_count--;
+    }
+    char digits[24];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), fraction);
+    out += '.';
+    out.append(digit_count - (result.ptr - digits), '0');
+    out.append(digits, result.ptr);
 }
 
 // Méthode permettant de transformer un ordre en chaîne de caractère
-std::string CsvWriter::OrderToString(OrderResult order_result){
+std::string CsvWriter::OrderToString(const OrderResult& order_result){
+    std::string output;
+    appendRow(order_result, output);
+    output.pop_back();
+    return output;
+}
 
-    // Récupération des caractéristiques de l'ordre initial
-    Order order = order_result.original_order;
+// Ajout d'une ligne du CSV à un buffer : tous les champs de OrderResult, séparés par des virgules
+void CsvWriter::appendRow(const OrderResult& order_result, std::string& out){
+    appendRow(order_result, order_result.original_order.instrument.tick(), out);
+}
 
-    // Concaténation de toutes les valeurs de OrderResult
-    std::string output = std::to_string(order.timestamp) + "," + 
-                        std::to_string(order.order_id) + "," + 
-                        order.instrument + "," +
-                        order.side + "," + 
-                        order.type + "," + 
-                        std::to_string(order.quantity) + "," +
-                        formatPrice(order.price) + "," + // Pour arrondir à deux décimales
-                        order.action + "," + 
-                        order_result.status + "," +
-                        std::to_string(order_result.executed_quantity) + "," + 
-                        formatPrice(order_result.execution_price) + "," + // Pour arrondir à 2 décimales 
-                        std::to_string(order_result.counterparty_id); 
+void CsvWriter::appendRow(const OrderResult& order_result, TickSize tick, std::string& out){
 
-    // Récupération de l'output
-    return(output);
+    // Récupération des caractéristiques de l'ordre initial
+    const Order& order = order_result.original_order;
+
+    appendInteger(out, order.timestamp);
+    out += ',';
+    appendInteger(out, order.order_id);
+    out += ',';
+    out += order.instrument.name();   // Seul endroit où le nom de l'instrument est relu
+    out += ',';
+    out += toLabel(order.side);
+    out += ',';
+    out += toLabel(order.type);
+    out += ',';
+    appendInteger(out, order.quantity);
+    out += ',';
+    appendPrice(order.price, tick, out);   // Prix en ticks -> décimal
+    out += ',';
+    out += toLabel(order.action);
+    out += ',';
+    out += toLabel(order_result.status);
+    out += ',';
+    appendInteger(out, order_result.executed_quantity);
+    out += ',';
+    appendPrice(order_result.execution_price, tick, out);   // Prix en ticks -> décimal
+    out += ',';
+    appendInteger(out, order_result.counterparty_id);
+    out += '\n';
+}
+
+const char* CsvWriter::header(){
+    return "timestamp,order_id,instrument,side,type,quantity,price,action,status,executed_quantity,execution_price,counterparty_id";
 }
 
-void CsvWriter::WriteToCsv(std::vector<OrderResult> resOrders){
+template <typename Results>
+void CsvWriter::writeRows(const Results& resOrders){
 
     // Création du fichier
-    std::ofstream output_file;
+    std::ofstream output_file(filename, std::ios::binary);
+    if (!output_file) {
+        LOG_ERROR("Impossible d'ouvrir ", filename);
+        return;
+    }
 
-    // Modification du nom du fichier
-    output_file.open(filename);
+    buffer.clear();
+    buffer.reserve(WRITE_BUFFER_SIZE + 512);
+    buffer += header();
+    buffer += '\n';
+
+    // Boucle sur les les trades de l'historique : formatage dans le buffer, écrit par blocs
+    for (const OrderResult& current_order : resOrders) {
+        appendRow(current_order, buffer);
+        if (buffer.size() >= WRITE_BUFFER_SIZE) {
+            output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+
+    // Fermeture du fichier
+    output_file.close();
+}
+
+// Les lignes d'une vue sont reconstituées une à une à partir des colonnes (sans copie de l'historique)
+void CsvWriter::WriteToCsv(ResultView resOrders){
+    writeRows(resOrders);
+}
+
+void CsvWriter::WriteToCsv(const std::vector<OrderResult>& resOrders){
+    writeRows(resOrders);
+}
 
-    output_file << "timestamp,order_id,instrument,side,type,quantity,price,action,status,executed_quantity,execution_price,counterparty_id" << std::endl;
+// ################################################################################################
+// Écriture au fil de l'eau
+// ################################################################################################
 
-    // Boucle sur les les trades de l'historique
-    for(u_long i = 0; i < resOrders.size(); i++){
-        
-        // Récupération de l'ordre courant
-        OrderResult current_order = resOrders[i];
+CsvStreamWriter::CsvStreamWriter(const std::string& filename) : output_file(filename, std::ios::binary) {
+    if (!output_file) {
+        LOG_ERROR("Impossible d'ouvrir ", filename);
+        return;
+    }
+    buffer.reserve(WRITE_BUFFER_SIZE + 512);
+    buffer += CsvWriter::header();
+    buffer += '\n';
+}
 
-        // Récupération de la chaîne de caractère à passer dans le CSV
-        std::string string_order = OrderToString(current_order);
+CsvStreamWriter::~CsvStreamWriter() {
+    flush();
+}
 
-        // Ecriture dans le fichier csv
-        output_file << string_order << std::endl;
+void CsvStreamWriter::onResult(const OrderResult& result) {
+    formatter.appendRow(result, buffer);
+    if (buffer.size() >= WRITE_BUFFER_SIZE) {
+        flush();
     }
+}
 
-    // Fermeture du fichier
-    output_file.close();
+void CsvStreamWriter::flush() {
+    if (output_file) {
+        output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    buffer.clear();
 }
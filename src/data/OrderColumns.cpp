@@ -0,0 +1,231 @@
+#include <cstring>
+#include <fstream>
+#include "data/OrderColumns.h"
+#include "utils/Logger.h"
+
+namespace {
+    // Ajout de la colonne d'un champ : ses valeurs à largeur fixe, à partir d'une position alignée sur 8 octets
+    template <typename T, typename Getter>
+    uint64_t appendColumn(std::string& out, const std::vector<Order>& orders, Getter get) {
+        out.append((8 - out.size() % 8) % 8, '\0');
+        uint64_t offset = out.size();
+        out.resize(offset + orders.size() * sizeof(T));
+        T* values = reinterpret_cast<T*>(&out[offset]);
+        for (size_t i = 0; i < orders.size(); i++) {
+            values[i] = static_cast<T>(get(orders[i]));
+        }
+        return offset;
+    }
+
+    // Varint zigzag : les petits écarts (positifs ou négatifs) tiennent sur peu d'octets
+    void appendVarint(std::string& out, int64_t value) {
+        uint64_t zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        while (zigzag >= 0x80) {
+            out += static_cast<char>((zigzag & 0x7F) | 0x80);
+            zigzag >>= 7;
+        }
+        out += static_cast<char>(zigzag);
+    }
+
+    // Un int64 en varint tient sur 10 octets au plus (7 bits utiles par octet)
+    constexpr int MAX_VARINT_BYTES = 10;
+
+    // Lecture d'un varint zigzag dans data[pos, end) (pos avance sur l'octet suivant).
+    // Renvoie false si le varint dépasse end ou MAX_VARINT_BYTES octets (fichier tronqué ou corrompu).
+    bool readVarint(const uint8_t* data, size_t end, size_t& pos, int64_t& value) {
+        uint64_t zigzag = 0;
+        for (int i = 0; i < MAX_VARINT_BYTES; i++) {
+            if (pos >= end) {
+                return false;
+            }
+            uint8_t byte = data[pos++];
+            zigzag |= static_cast<uint64_t>(byte & 0x7F) << (7 * i);
+            if ((byte & 0x80) == 0) {
+                value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+// ################################################################################################
+// Écriture
+// ################################################################################################
+
+// Initialisation avec le nom du fichier à créer
+OrderColumnsWriter::OrderColumnsWriter(std::string filename) : filename(std::move(filename)) {}
+
+bool OrderColumnsWriter::WriteColumns(const std::vector<Order>& orders) {
+    // Dictionnaire des instruments (dans l'ordre d'apparition, indexé par ID de la table des symboles)
+    // et libellés bruts utilisés
+    constexpr uint32_t NO_CODE = UINT32_MAX;
+    std::vector<uint32_t> instrument_codes(SymbolTable::size(), NO_CODE);
+    std::vector<Instrument> instruments;
+    std::vector<uint16_t> codes;
+    codes.reserve(orders.size());
+    bool raw_label_used[256] = {};
+    for (const Order& order : orders) {
+        if (order.instrument.id >= instrument_codes.size()) {
+            instrument_codes.resize(order.instrument.id + 1, NO_CODE);
+        }
+        uint32_t& code = instrument_codes[order.instrument.id];
+        if (code == NO_CODE) {
+            if (instruments.size() > UINT16_MAX) {
+                LOG_ERROR("Trop d'instruments pour le format en colonnes : ", filename);
+                return false;
+            }
+            code = static_cast<uint32_t>(instruments.size());
+            instruments.push_back(order.instrument);
+        }
+        codes.push_back(static_cast<uint16_t>(code));
+        markRawLabels(raw_label_used, order.side, order.action);
+    }
+
+    // En-tête (complété une fois les positions des colonnes connues) et dictionnaires
+    std::string buffer;
+    OrderColumnsHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, ORDER_COLUMNS_MAGIC, sizeof(header.magic));
+    header.version = ORDER_COLUMNS_VERSION;
+    header.instrument_count = static_cast<uint32_t>(instruments.size());
+    header.row_count = orders.size();
+    appendRaw(buffer, header);
+    header.raw_label_count = writeDictionary(buffer, instruments, raw_label_used);
+
+    // Timestamps : écarts successifs en varint
+    buffer.append((8 - buffer.size() % 8) % 8, '\0');
+    header.timestamp_offset = buffer.size();
+    long long previous = 0;
+    for (const Order& order : orders) {
+        appendVarint(buffer, order.timestamp - previous);
+        previous = order.timestamp;
+    }
+    header.timestamp_bytes = buffer.size() - header.timestamp_offset;
+
+    // Colonnes à largeur fixe
+    header.order_id_offset = appendColumn<int32_t>(buffer, orders, [](const Order& o) { return o.order_id; });
+    header.quantity_offset = appendColumn<int32_t>(buffer, orders, [](const Order& o) { return o.quantity; });
+    header.price_offset = appendColumn<int64_t>(buffer, orders, [](const Order& o) { return o.price; });
+    buffer.append((8 - buffer.size() % 8) % 8, '\0');
+    header.instrument_offset = buffer.size();
+    buffer.append(reinterpret_cast<const char*>(codes.data()), codes.size() * sizeof(uint16_t));
+    header.side_offset = appendColumn<uint8_t>(buffer, orders, [](const Order& o) { return o.side; });
+    header.type_offset = appendColumn<uint8_t>(buffer, orders, [](const Order& o) { return o.type; });
+    header.action_offset = appendColumn<uint8_t>(buffer, orders, [](const Order& o) { return o.action; });
+    std::memcpy(&buffer[0], &header, sizeof(header));
+
+    std::ofstream output_file(filename, std::ios::binary);
+    if (!output_file) {
+        LOG_ERROR("Impossible d'ouvrir ", filename);
+        return false;
+    }
+    output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(output_file);
+}
+
+// ################################################################################################
+// Lecture
+// ################################################################################################
+
+bool OrderColumnsFile::isColumnFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(ORDER_COLUMNS_MAGIC)];
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, ORDER_COLUMNS_MAGIC, sizeof(magic)) == 0;
+}
+
+OrderColumnsFile::OrderColumnsFile(const std::string& filename)
+    : file_(filename), valid_(false), header_() {
+    const char* data = file_.data();
+    size_t size = file_.size();
+    if (data == nullptr || size < sizeof(OrderColumnsHeader)) {
+        LOG_ERROR("Fichier en colonnes vide ou introuvable : ", filename);
+        return;
+    }
+    std::memcpy(&header_, data, sizeof(header_));
+    if (std::memcmp(header_.magic, ORDER_COLUMNS_MAGIC, sizeof(header_.magic)) != 0
+        || header_.version != ORDER_COLUMNS_VERSION) {
+        LOG_ERROR("Format de fichier en colonnes non reconnu : ", filename);
+        return;
+    }
+
+    // Chaque colonne doit tenir dans le fichier (calcul sans débordement, même pour un en-tête forgé)
+    // et commencer sur une position alignée pour son type (lecture sur place après mmap)
+    uint64_t rows = header_.row_count;
+    auto fits = [size, rows](uint64_t offset, size_t width) {
+        return offset <= size && (size - offset) / width >= rows && offset % width == 0;
+    };
+    bool complete = header_.timestamp_offset <= size && header_.timestamp_bytes <= size - header_.timestamp_offset
+        && fits(header_.order_id_offset, sizeof(int32_t))
+        && fits(header_.quantity_offset, sizeof(int32_t))
+        && fits(header_.price_offset, sizeof(int64_t))
+        && fits(header_.instrument_offset, sizeof(uint16_t))
+        && fits(header_.side_offset, sizeof(uint8_t))
+        && fits(header_.type_offset, sizeof(uint8_t))
+        && fits(header_.action_offset, sizeof(uint8_t));
+    if (!complete) {
+        LOG_ERROR("Fichier en colonnes tronqué ou mal aligné : ", filename);
+        return;
+    }
+
+    // Dictionnaire des instruments (les prix sont en ticks du fichier, gardés avec l'instrument) et libellés bruts
+    size_t pos = sizeof(OrderColumnsHeader);
+    if (!readDictionary(data, pos, header_.timestamp_offset, header_.instrument_count, header_.raw_label_count,
+                        filename, dictionary_)) {
+        return;
+    }
+
+    // Codes d'instrument dans le dictionnaire, codes de côté, type et action connus ou définis par la table
+    // des libellés (contrôlés une fois ici : les accesseurs des colonnes ne contrôlent plus rien)
+    const uint16_t* codes = instrumentCodes();
+    const uint8_t* sides = sideCodes();
+    const uint8_t* types = typeCodes();
+    const uint8_t* actions = actionCodes();
+    for (uint64_t i = 0; i < rows; i++) {
+        if (codes[i] >= dictionary_.instruments.size()) {
+            LOG_ERROR("Code d'instrument invalide dans ", filename);
+            return;
+        }
+        if (!isValidOrderCodes(sides[i], types[i], actions[i], dictionary_.raw_label_defined)) {
+            LOG_ERROR("Code de côté, type ou action invalide dans ", filename);
+            return;
+        }
+    }
+
+    // Timestamps : chaque varint doit tenir dans sa colonne
+    const uint8_t* timestamp_bytes = reinterpret_cast<const uint8_t*>(data + header_.timestamp_offset);
+    timestamps_.resize(rows);
+    size_t timestamp_pos = 0;
+    long long timestamp = 0;
+    for (uint64_t i = 0; i < rows; i++) {
+        int64_t delta;
+        if (!readVarint(timestamp_bytes, header_.timestamp_bytes, timestamp_pos, delta)) {
+            LOG_ERROR("Colonne des timestamps tronquée ou corrompue : ", filename);
+            timestamps_.clear();
+            return;
+        }
+        timestamp += delta;
+        timestamps_[i] = timestamp;
+    }
+    valid_ = true;
+}
+
+Price OrderColumnsFile::price(size_t i) const {
+    uint16_t code = instrumentCodes()[i];
+    return convertTicks(prices()[i], dictionary_.ticks[code], dictionary_.instruments[code].tick());
+}
+
+Order OrderColumnsFile::order(size_t i) const {
+    return Order{timestamps_[i], orderIds()[i], dictionary_.instruments[instrumentCodes()[i]], side(i),
+                 static_cast<OrderType>(typeCodes()[i]), quantities()[i], price(i), action(i)};
+}
+
+void OrderColumnsFile::appendOrders(std::vector<Order>& out) const {
+    if (!valid_) {
+        return;
+    }
+    out.reserve(out.size() + header_.row_count);
+    for (uint64_t i = 0; i < header_.row_count; i++) {
+        out.push_back(order(i));
+    }
+}
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include "data/OrderFlowGenerator.h"
+
+namespace {
+    const char* const INSTRUMENT_NAMES[] = {"AAPL", "MSFT", "GOOG", "AMZN", "META", "NVDA", "TSLA", "NFLX"};
+    constexpr size_t NAMED_INSTRUMENT_COUNT = sizeof(INSTRUMENT_NAMES) / sizeof(INSTRUMENT_NAMES[0]);
+
+    // Nombre maximal d'ordres suivis par instrument (au-delà, un ordre suivi au hasard est remplacé) :
+    // la mémoire du générateur reste bornée même sur 100M d'ordres
+    constexpr size_t MAX_LIVE_ORDERS = 1 << 16;
+
+    template <typename T>
+    void appendInteger(std::string& out, T value) {
+        char digits[24];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, result.ptr);
+    }
+}
+
+// Constructeur : instruments, répartition de Zipf et état initial de chaque carnet
+OrderFlowGenerator::OrderFlowGenerator(const OrderFlowConfig& config)
+    : config(config), rng_state(config.seed), timestamp(1617235200000000000LL), next_id(1) {
+    size_t count = std::max<size_t>(1, config.instrument_count);
+    double total = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        total += 1.0 / std::pow(static_cast<double>(i + 1), config.zipf_skew);
+        instrument_cdf.push_back(total);
+
+        InstrumentState state;
+        if (i < NAMED_INSTRUMENT_COUNT) {
+            state.instrument = Instrument(INSTRUMENT_NAMES[i]);
+        } else {
+            std::string number = std::to_string(i);
+            state.instrument = Instrument("SYM" + std::string(4 - std::min<size_t>(4, number.size()), '0') + number);
+        }
+        state.mid = config.initial_mid;
+        state.mid_drift = 0.0;
+        instruments.push_back(std::move(state));
+    }
+    for (double& bound : instrument_cdf) {
+        bound /= total;
+    }
+}
+
+// Générateur splitmix64 : rapide, de bonne qualité statistique et entièrement déterminé par la graine
+uint64_t OrderFlowGenerator::nextRandom() {
+    uint64_t z = (rng_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+double OrderFlowGenerator::nextUniform() {
+    return static_cast<double>(nextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint64_t OrderFlowGenerator::nextBelow(uint64_t bound) {
+    return bound <= 1 ? 0 : nextRandom() % bound;
+}
+
+// Loi normale centrée réduite (Box-Muller)
+double OrderFlowGenerator::nextGaussian() {
+    double u1 = 1.0 - nextUniform();
+    double u2 = nextUniform();
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+size_t OrderFlowGenerator::pickInstrument() {
+    double u = nextUniform();
+    size_t index = std::lower_bound(instrument_cdf.begin(), instrument_cdf.end(), u) - instrument_cdf.begin();
+    return std::min(index, instrument_cdf.size() - 1);
+}
+
+Order OrderFlowGenerator::next() {
+    InstrumentState& state = instruments[pickInstrument()];
+    timestamp += 1 + static_cast<long long>(nextBelow(1000000));
+
+    // Marche aléatoire du prix milieu (jamais sous un prix minimal de book_depth + 1 ticks)
+    state.mid_drift += config.volatility * nextGaussian();
+    int64_t step = static_cast<int64_t>(state.mid_drift);
+    state.mid_drift -= static_cast<double>(step);
+    state.mid = std::max<int64_t>(state.mid + step, config.book_depth + 1);
+
+    // MODIFY / CANCEL d'un ordre déjà émis (NEW s'il n'y en a pas encore)
+    double action_draw = nextUniform();
+    bool modify = action_draw < config.modify_ratio;
+    bool cancel = !modify && action_draw < config.modify_ratio + config.cancel_ratio;
+    if ((modify || cancel) && !state.live_orders.empty()) {
+        size_t target = nextBelow(state.live_orders.size());
+        LiveOrder& live = state.live_orders[target];
+        if (modify) {
+            int sign = (live.side == Side::BUY) ? -1 : 1;
+            live.quantity = 1 + static_cast<int>(nextBelow(config.max_quantity));
+            live.price = std::max<int64_t>(1, state.mid + sign * static_cast<int64_t>(nextBelow(config.book_depth)));
+        }
+        Order order{timestamp, live.order_id, state.instrument, live.side, OrderType::LIMIT, live.quantity, live.price,
+                    modify ? Action::MODIFY : Action::CANCEL};
+        if (cancel) {
+            // Un ordre annulé ne peut plus être visé
+            live = state.live_orders.back();
+            state.live_orders.pop_back();
+        }
+        return order;
+    }
+    return newOrder(state);
+}
+
+Order OrderFlowGenerator::newOrder(InstrumentState& state) {
+    Order order{timestamp, next_id++, state.instrument, (nextRandom() & 1) ? Side::BUY : Side::SELL, OrderType::LIMIT,
+                1 + static_cast<int>(nextBelow(config.max_quantity)), 0, Action::NEW};
+    if (nextUniform() < config.market_share) {
+        order.type = OrderType::MARKET;
+        return order;
+    }
+
+    // LIMIT : passif sur book_depth niveaux de son côté, ou agressif jusqu'à 3 niveaux au-delà du milieu
+    int sign = (order.side == Side::BUY) ? -1 : 1;
+    if (nextUniform() < config.aggressive_share) {
+        order.price = state.mid - sign * static_cast<int64_t>(1 + nextBelow(3));
+    } else {
+        order.price = state.mid + sign * static_cast<int64_t>(nextBelow(config.book_depth));
+    }
+    order.price = std::max<int64_t>(1, order.price);
+
+    LiveOrder live{order.order_id, order.side, order.quantity, order.price};
+    if (state.live_orders.size() < MAX_LIVE_ORDERS) {
+        state.live_orders.push_back(live);
+    } else {
+        state.live_orders[nextBelow(state.live_orders.size())] = live;
+    }
+    return order;
+}
+
+// Format d'input : timestamp,order_id,instrument,side,type,quantity,price,action (prix au centime)
+void OrderFlowGenerator::appendCsvRow(const Order& order, std::string& out) {
+    appendInteger(out, order.timestamp);
+    out += ',';
+    appendInteger(out, order.order_id);
+    out += ',';
+    out += order.instrument.name();
+    out += ',';
+    out += toLabel(order.side);
+    out += ',';
+    out += toLabel(order.type);
+    out += ',';
+    appendInteger(out, order.quantity);
+    out += ',';
+    if (order.type == OrderType::MARKET) {
+        out += "0.0";
+    } else {
+        appendInteger(out, order.price / 100);
+        out += '.';
+        out += static_cast<char>('0' + order.price / 10 % 10);
+        out += static_cast<char>('0' + order.price % 10);
+    }
+    out += ',';
+    out += toLabel(order.action);
+}
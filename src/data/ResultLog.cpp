@@ -0,0 +1,284 @@
+#include <cstring>
+#include <fstream>
+#include "data/ResultLog.h"
+#include "data/CSVWriter.h"
+#include "utils/Logger.h"
+
+// ################################################################################################
+// Dictionnaire (commun au journal binaire et au fichier en colonnes)
+// ################################################################################################
+
+uint32_t writeDictionary(std::string& out, const std::vector<Instrument>& instruments,
+                         const bool (&raw_label_used)[256]) {
+    for (Instrument instrument : instruments) {
+        TickSize tick = instrument.tick();
+        ResultLogSymbol symbol{tick.units, tick.decimals, static_cast<uint32_t>(instrument.name().size())};
+        appendRaw(out, symbol);
+        out += instrument.name();
+    }
+    uint32_t label_count = 0;
+    for (int code = FIRST_RAW_LABEL; code < 256; code++) {
+        if (!raw_label_used[code]) {
+            continue;
+        }
+        const std::string& text = RawLabels::get(static_cast<uint8_t>(code));
+        ResultLogLabel label{static_cast<uint8_t>(code), 0, static_cast<uint16_t>(text.size())};
+        appendRaw(out, label);
+        out.append(text, 0, label.length);
+        label_count++;
+    }
+    return label_count;
+}
+
+FileDictionary::FileDictionary() {
+    for (int code = 0; code < 256; code++) {
+        raw_label_codes[code] = static_cast<uint8_t>(code);
+        raw_label_defined[code] = false;
+    }
+}
+
+bool readDictionary(const char* data, size_t& pos, size_t end, uint32_t symbol_count, uint32_t raw_label_count,
+                    [[maybe_unused]] const std::string& filename, FileDictionary& dictionary) {
+    if (pos > end) {
+        LOG_ERROR("Table des symboles tronquée : ", filename);
+        return false;
+    }
+
+    // Table des symboles : instruments enregistrés dans ce processus, ticks du fichier gardés à part
+    for (uint32_t i = 0; i < symbol_count; i++) {
+        ResultLogSymbol symbol;
+        if (end - pos < sizeof(symbol)) {
+            LOG_ERROR("Table des symboles tronquée : ", filename);
+            return false;
+        }
+        std::memcpy(&symbol, data + pos, sizeof(symbol));
+        pos += sizeof(symbol);
+        if (end - pos < symbol.name_length) {
+            LOG_ERROR("Table des symboles tronquée : ", filename);
+            return false;
+        }
+        dictionary.names.emplace_back(data + pos, symbol.name_length);
+        dictionary.instruments.emplace_back(dictionary.names.back());
+        if (!dictionary.instruments.back().isValid()) {
+            LOG_ERROR("Instrument non enregistré : ", filename);
+            return false;
+        }
+        dictionary.ticks.push_back(TickSize{symbol.tick_decimals, symbol.tick_units});
+        pos += symbol.name_length;
+    }
+
+    // Libellés bruts : enregistrés dans ce processus, le code du fichier est traduit.
+    // Un code inférieur à FIRST_RAW_LABEL remplacerait une valeur connue (BUY, NEW, ...) : fichier refusé.
+    for (uint32_t i = 0; i < raw_label_count; i++) {
+        ResultLogLabel label;
+        if (end - pos < sizeof(label)) {
+            LOG_ERROR("Table des libellés tronquée : ", filename);
+            return false;
+        }
+        std::memcpy(&label, data + pos, sizeof(label));
+        pos += sizeof(label);
+        if (end - pos < label.length) {
+            LOG_ERROR("Table des libellés tronquée : ", filename);
+            return false;
+        }
+        if (label.code < FIRST_RAW_LABEL) {
+            LOG_ERROR("Code de libellé brut invalide dans ", filename);
+            return false;
+        }
+        dictionary.raw_label_codes[label.code] = RawLabels::intern(std::string_view(data + pos, label.length));
+        dictionary.raw_label_defined[label.code] = true;
+        pos += label.length;
+    }
+    return true;
+}
+
+bool isValidOrderCodes(uint8_t side, uint8_t type, uint8_t action, const bool (&raw_label_defined)[256]) {
+    return (side <= static_cast<uint8_t>(Side::SELL) || raw_label_defined[side])
+        && type <= static_cast<uint8_t>(OrderType::BAD_INPUT)
+        && (action <= static_cast<uint8_t>(Action::CANCEL) || raw_label_defined[action]);
+}
+
+bool isValidStatusCode(uint8_t status) {
+    return status <= static_cast<uint8_t>(OrderStatus::REJECTED);
+}
+
+// ################################################################################################
+// Écriture
+// ################################################################################################
+
+// Initialisation avec le nom du fichier à créer
+ResultLogWriter::ResultLogWriter(std::string filename) : filename(std::move(filename)) {}
+
+bool ResultLogWriter::WriteToBinary(ResultView resOrders) {
+    const ResultTable& table = resOrders.table();
+    size_t first = resOrders.offset();
+    size_t last = first + resOrders.size();
+
+    // Premier passage (colonnes instrument, côté et action seulement) : IDs des instruments dans le fichier
+    // (dans l'ordre d'apparition), indexés par leur ID dans la table des symboles, et libellés bruts utilisés
+    std::vector<uint32_t> instrument_ids(SymbolTable::size(), UINT32_MAX);
+    std::vector<Instrument> instruments;
+    bool raw_label_used[256] = {};
+    for (size_t i = first; i < last; i++) {
+        Instrument instrument = table.instrument(i);
+        if (instrument.id >= instrument_ids.size()) {
+            instrument_ids.resize(instrument.id + 1, UINT32_MAX);
+        }
+        if (instrument_ids[instrument.id] == UINT32_MAX) {
+            instrument_ids[instrument.id] = static_cast<uint32_t>(instruments.size());
+            instruments.push_back(instrument);
+        }
+        markRawLabels(raw_label_used, table.side(i), table.action(i));
+    }
+
+    // En-tête et tables
+    std::string buffer;
+    buffer.reserve(WRITE_BUFFER_SIZE + sizeof(ResultRecord));
+    ResultLogHeader header;
+    std::memcpy(header.magic, RESULT_LOG_MAGIC, sizeof(header.magic));
+    header.version = RESULT_LOG_VERSION;
+    header.record_size = sizeof(ResultRecord);
+    header.symbol_count = static_cast<uint32_t>(instruments.size());
+    header.raw_label_count = 0;
+    header.record_count = resOrders.size();
+    header.records_offset = 0;
+    appendRaw(buffer, header);
+    header.raw_label_count = writeDictionary(buffer, instruments, raw_label_used);
+
+    // Les enregistrements commencent sur un multiple de 8 octets (lecture alignée après mmap)
+    buffer.append((8 - buffer.size() % 8) % 8, '\0');
+    header.records_offset = buffer.size();
+    std::memcpy(&buffer[0], &header, sizeof(header));
+
+    std::ofstream output_file(filename, std::ios::binary);
+    if (!output_file) {
+        LOG_ERROR("Impossible d'ouvrir ", filename);
+        return false;
+    }
+
+    // Enregistrements, écrits par blocs
+    for (size_t i = first; i < last; i++) {
+        ResultRecord record;
+        record.timestamp = table.timestamp(i);
+        record.price = table.price(i);
+        record.execution_price = table.executionPrice(i);
+        record.order_id = table.orderId(i);
+        record.quantity = table.quantity(i);
+        record.executed_quantity = table.executedQuantity(i);
+        record.counterparty_id = table.counterpartyId(i);
+        record.instrument_id = instrument_ids[table.instrument(i).id];
+        record.side = static_cast<uint8_t>(table.side(i));
+        record.type = static_cast<uint8_t>(table.type(i));
+        record.action = static_cast<uint8_t>(table.action(i));
+        record.status = static_cast<uint8_t>(table.status(i));
+        appendRaw(buffer, record);
+
+        if (buffer.size() >= WRITE_BUFFER_SIZE) {
+            output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    output_file.close();
+    if (!output_file) {
+        LOG_ERROR("Erreur d'écriture dans ", filename);
+        return false;
+    }
+    return true;
+}
+
+// ################################################################################################
+// Lecture
+// ################################################################################################
+
+ResultLogReader::ResultLogReader(const std::string& filename)
+    : file_(filename), valid_(false), header_(), records_(nullptr) {
+    const char* data = file_.data();
+    size_t size = file_.size();
+    if (data == nullptr || size < sizeof(ResultLogHeader)) {
+        LOG_ERROR("Journal binaire vide ou introuvable : ", filename);
+        return;
+    }
+    std::memcpy(&header_, data, sizeof(header_));
+    if (std::memcmp(header_.magic, RESULT_LOG_MAGIC, sizeof(header_.magic)) != 0
+        || header_.version != RESULT_LOG_VERSION || header_.record_size != sizeof(ResultRecord)) {
+        LOG_ERROR("Format de journal binaire non reconnu : ", filename);
+        return;
+    }
+    if (header_.records_offset > size || header_.records_offset % 8 != 0
+        || (size - header_.records_offset) / sizeof(ResultRecord) < header_.record_count) {
+        LOG_ERROR("Journal binaire tronqué : ", filename);
+        return;
+    }
+
+    // Table des symboles et libellés bruts
+    size_t pos = sizeof(ResultLogHeader);
+    if (!readDictionary(data, pos, header_.records_offset, header_.symbol_count, header_.raw_label_count,
+                        filename, dictionary_)) {
+        return;
+    }
+
+    // ID d'instrument de chaque enregistrement dans la table des symboles, et codes des enums
+    // (connus ou définis par la table des libellés)
+    records_ = reinterpret_cast<const ResultRecord*>(data + header_.records_offset);
+    for (uint64_t i = 0; i < header_.record_count; i++) {
+        const ResultRecord& record = records_[i];
+        if (record.instrument_id >= header_.symbol_count) {
+            LOG_ERROR("ID d'instrument invalide dans ", filename);
+            records_ = nullptr;
+            return;
+        }
+        if (!isValidOrderCodes(record.side, record.type, record.action, dictionary_.raw_label_defined)
+            || !isValidStatusCode(record.status)) {
+            LOG_ERROR("Code de côté, type, action ou statut invalide dans ", filename);
+            records_ = nullptr;
+            return;
+        }
+    }
+    valid_ = true;
+}
+
+OrderResult ResultLogReader::toOrderResult(size_t index) const {
+    const ResultRecord& record = records_[index];
+    Order order;
+    order.timestamp = record.timestamp;
+    order.order_id = record.order_id;
+    order.instrument = dictionary_.instruments[record.instrument_id];
+    order.side = static_cast<Side>(dictionary_.raw_label_codes[record.side]);
+    order.type = static_cast<OrderType>(record.type);
+    order.quantity = record.quantity;
+    order.price = record.price;
+    order.action = static_cast<Action>(dictionary_.raw_label_codes[record.action]);
+
+    OrderResult result(order);
+    result.status = static_cast<OrderStatus>(record.status);
+    result.executed_quantity = record.executed_quantity;
+    result.execution_price = record.execution_price;
+    result.counterparty_id = record.counterparty_id;
+    return result;
+}
+
+bool ResultLogReader::writeCsv(const std::string& csv_filename) const {
+    if (!valid_) {
+        return false;
+    }
+    std::ofstream output_file(csv_filename, std::ios::binary);
+    if (!output_file) {
+        LOG_ERROR("Impossible d'ouvrir ", csv_filename);
+        return false;
+    }
+    CsvWriter writer;
+    std::string buffer;
+    buffer.reserve(WRITE_BUFFER_SIZE + 512);
+    buffer += CsvWriter::header();
+    buffer += '\n';
+    for (size_t i = 0; i < size(); i++) {
+        writer.appendRow(toOrderResult(i), dictionary_.ticks[records_[i].instrument_id], buffer);
+        if (buffer.size() >= WRITE_BUFFER_SIZE) {
+            output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    output_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(output_file);
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cmath>
+#include "utils/LatencyHistogram.h"
+
+// Nombre d'intervalles : les 2 * 128 valeurs exactes, puis 128 intervalles par puissance de 2 (de 2^8 à 2^63)
+LatencyHistogram::LatencyHistogram()
+    : counts(2 * SUB_BUCKET_COUNT + (63 - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT, 0),
+      total_count(0), min_value(UINT64_MAX), max_value(0), sum(0) {}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < 2 * SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    // On garde les SUB_BUCKET_BITS + 1 bits de poids fort de la valeur
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - SUB_BUCKET_BITS;
+    uint64_t top = value >> shift;    // dans [128, 256)
+    return 2 * SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_COUNT + static_cast<size_t>(top - SUB_BUCKET_COUNT);
+}
+
+uint64_t LatencyHistogram::bucketHighestValue(size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return index;
+    }
+    size_t offset = index - 2 * SUB_BUCKET_COUNT;
+    int shift = static_cast<int>(offset / SUB_BUCKET_COUNT) + 1;
+    uint64_t top = offset % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((top + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    counts[bucketIndex(value)]++;
+    total_count++;
+    min_value = std::min(min_value, value);
+    max_value = std::max(max_value, value);
+    sum += value;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    if (total_count == 0) {
+        return 0;
+    }
+    // Rang de la valeur recherchée (au moins la première)
+    double rank = std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * static_cast<double>(total_count));
+    size_t target = std::max<size_t>(1, static_cast<size_t>(rank));
+    size_t seen = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        seen += counts[i];
+        if (seen >= target) {
+            return std::min(bucketHighestValue(i), max_value);
+        }
+    }
+    return max_value;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < counts.size(); i++) {
+        counts[i] += other.counts[i];
+    }
+    total_count += other.total_count;
+    min_value = std::min(min_value, other.min_value);
+    max_value = std::max(max_value, other.max_value);
+    sum += other.sum;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(counts.begin(), counts.end(), 0);
+    total_count = 0;
+    min_value = UINT64_MAX;
+    max_value = 0;
+    sum = 0;
+}
@@ -0,0 +1,163 @@
+#include <cstddef>
+#include <cstdlib>
+#include "utils/Logger.h"
+
+namespace {
+    const char* levelTag(LogLevel level) {
+        switch (level) {
+            case LogLevel::DEBUG: return "[DEBUG] ";
+            case LogLevel::INFO: return "[INFO] ";
+            case LogLevel::WARN: return "[WARN] ";
+            case LogLevel::ERROR: return "[ERROR] ";
+        }
+        return "";
+    }
+}
+
+Logger& Logger::instance() {
+    // Instance jamais détruite : un objet statique peut encore logger pendant la sortie du programme
+    // (le message est alors simplement ignoré). Le thread est arrêté proprement par atexit.
+    static Logger* logger = [] {
+        Logger* created = new Logger();
+        std::atexit([] { Logger::instance().shutdown(); });
+        return created;
+    }();
+    return *logger;
+}
+
+// Constructeur : toutes les cases sont libres pour la position qui porte leur numéro
+Logger::Logger()
+    : cells(new Cell[CAPACITY]), enqueue_pos(0), dequeue_pos(0), written_count(0), dropped_count(0),
+      running(true), output(stdout), sleeping(false) {
+    for (size_t i = 0; i < CAPACITY; i++) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    worker = std::thread(&Logger::run, this);
+}
+
+void Logger::push(const LogLine& line) {
+    // ################################################################################################
+    // Dépôt sans verrou : on réserve une position par CAS sur enqueue_pos, on copie le message dans la case
+    // puis on la publie pour le thread d'écriture en avançant son numéro de séquence.
+    // ################################################################################################
+    if (!running.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    uint64_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells[pos & MASK];
+        uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            // Case libre : on tente de la réserver
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Buffer plein : on perd le message plutôt que de bloquer le thread appelant
+            dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            // Un autre producteur a pris la case entre-temps
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::memcpy(&cell->line, &line, offsetof(LogLine, text) + line.length);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    // Réveil du thread d'écriture s'il s'est endormi. La barrière fait pendant à celle de run() : soit le
+    // thread d'écriture voit le message avant de s'endormir, soit on le voit endormi et on le réveille.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed)) {
+        wakeWriter();
+    }
+}
+
+void Logger::wakeWriter() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        sleeping.store(false, std::memory_order_relaxed);
+    }
+    wake.notify_one();
+}
+
+void Logger::run() {
+    // ################################################################################################
+    // Thread d'écriture : on écrit les messages dans l'ordre des positions, on libère leur case,
+    // et on ne vide le buffer de stdio (appel système) que lorsqu'il n'y a plus rien à écrire.
+    // ################################################################################################
+    bool pending_flush = false;
+    while (true) {
+        Cell& cell = cells[dequeue_pos & MASK];
+        if (cell.sequence.load(std::memory_order_acquire) == dequeue_pos + 1) {
+            write(cell.line);
+            cell.sequence.store(dequeue_pos + CAPACITY, std::memory_order_release);
+            dequeue_pos++;
+            written_count.store(dequeue_pos, std::memory_order_release);
+            pending_flush = true;
+            continue;
+        }
+
+        // Plus rien à écrire pour l'instant
+        if (pending_flush) {
+            std::fflush(output.load(std::memory_order_relaxed));
+            pending_flush = false;
+        }
+        if (!running.load(std::memory_order_acquire) && dequeue_pos == enqueue_pos.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        // Buffer vide : on s'endort jusqu'au prochain dépôt (ou l'arrêt), après avoir revérifié la case
+        // une fois l'endormissement annoncé (un message déposé entre-temps ne doit pas attendre le suivant)
+        std::unique_lock<std::mutex> lock(wake_mutex);
+        sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (cell.sequence.load(std::memory_order_relaxed) == dequeue_pos + 1 || !running.load(std::memory_order_relaxed)) {
+            sleeping.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        wake.wait(lock, [this] { return !sleeping.load(std::memory_order_relaxed); });
+    }
+}
+
+void Logger::write(const LogLine& line) {
+    FILE* out = output.load(std::memory_order_relaxed);
+    std::fputs(levelTag(line.level), out);
+    std::fwrite(line.text, 1, line.length, out);
+    std::fputc('\n', out);
+}
+
+void Logger::flush() {
+    uint64_t target = enqueue_pos.load(std::memory_order_acquire);
+    if (sleeping.load(std::memory_order_relaxed) && written_count.load(std::memory_order_acquire) < target) {
+        wakeWriter();
+    }
+    while (running.load(std::memory_order_acquire) && written_count.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+    std::fflush(output.load(std::memory_order_relaxed));
+}
+
+void Logger::setOutput(FILE* new_output) {
+    flush();
+    output.store(new_output, std::memory_order_relaxed);
+}
+
+void Logger::shutdown() {
+    if (!running.exchange(false)) {
+        return;
+    }
+    wakeWriter();
+    if (worker.joinable()) {
+        worker.join();
+    }
+    uint64_t lost = dropped();
+    if (lost > 0) {
+        std::fprintf(output.load(std::memory_order_relaxed), "[WARN] %llu messages de log perdus (buffer plein)\n",
+                     static_cast<unsigned long long>(lost));
+    }
+    std::fflush(output.load(std::memory_order_relaxed));
+}
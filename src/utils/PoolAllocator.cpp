@@ -0,0 +1,57 @@
+#include <algorithm>
+#include "utils/PoolAllocator.h"
+
+namespace {
+    // Taille minimale d'un slab (en blocs) quand la réserve doit grandir
+    constexpr size_t MIN_SLAB_BLOCKS = 64;
+}
+
+// Constructeur : aucun bloc n'est découpé avant de connaître leur taille (première allocation)
+SlabPool::SlabPool(size_t reserved_blocks)
+    : reserved_blocks(reserved_blocks), block_size(0), block_count(0), used_count(0), free_list(nullptr) {}
+
+void SlabPool::addSlab(size_t count) {
+    // Les blocs du slab sont chaînés dans la liste libre (le premier bloc du slab en tête)
+    slabs.emplace_back(new unsigned char[count * block_size]);
+    unsigned char* slab = slabs.back().get();
+    for (size_t i = count; i-- > 0;) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * block_size);
+        block->next = free_list;
+        free_list = block;
+    }
+    block_count += count;
+}
+
+void* SlabPool::allocate(size_t size) {
+    if (block_size == 0) {
+        // Taille des blocs arrondie à l'alignement maximal (la liste libre est stockée dans les blocs libres)
+        constexpr size_t alignment = alignof(std::max_align_t);
+        block_size = (std::max(size, sizeof(FreeBlock)) + alignment - 1) / alignment * alignment;
+        if (reserved_blocks > 0) {
+            addSlab(reserved_blocks);
+        }
+    }
+    if (size > block_size) {
+        return ::operator new(size);
+    }
+
+    // Réserve épuisée : nouveau slab (aussi grand que tous les précédents réunis, la réserve double)
+    if (free_list == nullptr) {
+        addSlab(std::max(MIN_SLAB_BLOCKS, block_count));
+    }
+    FreeBlock* block = free_list;
+    free_list = block->next;
+    used_count++;
+    return block;
+}
+
+void SlabPool::deallocate(void* pointer, size_t size) {
+    if (size > block_size) {
+        ::operator delete(pointer);
+        return;
+    }
+    FreeBlock* block = static_cast<FreeBlock*>(pointer);
+    block->next = free_list;
+    free_list = block;
+    used_count--;
+}
@@ -0,0 +1,115 @@
+#include "utils/ThreadPool.h"
+#include <algorithm>
+
+// Constructeur : création des files et démarrage des workers
+ThreadPool::ThreadPool(size_t thread_count)
+    : next_queue(0), queued_count(0), stopping(false), pending_count(0) {
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        workers.emplace_back(&ThreadPool::run, this, i);
+    }
+}
+
+// Destructeur
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [this] { return pending_count == 0; });
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stopping = true;
+    }
+    sleep_cv.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(done_mutex);
+        pending_count++;
+    }
+    WorkQueue& queue = *queues[next_queue.fetch_add(1) % queues.size()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        // Incrément sous le mutex de sommeil : un worker qui s'endort ne peut pas rater la tâche
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        queued_count++;
+    }
+    sleep_cv.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cv.wait(lock, [this] { return pending_count == 0; });
+    if (first_error) {
+        std::exception_ptr error = first_error;
+        first_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+bool ThreadPool::popLocal(size_t index, std::function<void()>& task) {
+    // Le worker prend ses propres tâches dans l'ordre de soumission (les plus lourdes d'abord)
+    WorkQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+}
+
+bool ThreadPool::steal(size_t index, std::function<void()>& task) {
+    // Vol par l'arrière de la file des autres workers (les tâches les plus légères, soumises en dernier)
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        WorkQueue& queue = *queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run(size_t index) {
+    while (true) {
+        std::function<void()> task;
+        if (popLocal(index, task) || steal(index, task)) {
+            queued_count--;
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(done_mutex);
+                if (!first_error) {
+                    first_error = std::current_exception();
+                }
+            }
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (--pending_count == 0) {
+                done_cv.notify_all();
+            }
+            continue;
+        }
+
+        // Plus aucune tâche à prendre : on dort jusqu'à la prochaine soumission (ou l'arrêt du pool)
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleep_cv.wait(lock, [this] { return stopping || queued_count.load() > 0; });
+        if (stopping && queued_count.load() == 0) {
+            return;
+        }
+    }
+}
@@ -1,8 +1,14 @@
 // FICHIER DE TESTS SUR LA LOGIQUE ET LES EXCEPTIONS DU CSV Reader
 
 #include "data/CSVReader.h"
+#include "data/OrderColumns.h"
+#include "data/OrderFlowGenerator.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <iostream>
 #include <vector>
+#include <map>
 #include <cassert>
 
 // Macros de test : une de comparaison, une de vérité
@@ -30,14 +36,14 @@ void testOnlyBadInputs(){
 
     // Output attendu
     std::vector<Order> orders_expected = {
-        {0, 0,"AAPL" ,"BUY" ,"BAD_INPUT" , 0, 0, "NEW"},
-        {1617278400000000100, 0,"AAPL" ,"SELL" ,"BAD_INPUT" , 0, 0, "NEW"},
-        {1617278400000000200, 3 ,"ERROR" ,"SELL" ,"LIMIT" , 60, 150.300000, "NEW"},
-        {1617278400000000300, 0,"AAPL" ,"ERROR" ,"BAD_INPUT" , 0, 0, "NEW"},
-        {1617278400000000400, 0,"AAPL" ,"BUY" ,"BAD_INPUT", 0, 0, "MODIFY"},
-        {1617278400000000500, 0,"AAPL" ,"SELL" ,"BAD_INPUT" , 0, 0, "CANCEL"},
-        {1617278400000000600, 0,"AAPL" ,"SELL" ,"BAD_INPUT" , 0, 0, "CANCEL"},
-        {1617278400000000700, 0, "AAPL", "SELL", "BAD_INPUT", 0, 0.0, "ERROR"}
+        {0, 0, Instrument("AAPL"),Side::BUY ,OrderType::BAD_INPUT , 0, 0, Action::NEW},
+        {1617278400000000100, 0, Instrument("AAPL"),Side::SELL ,OrderType::BAD_INPUT , 0, 0, Action::NEW},
+        {1617278400000000200, 3 , Instrument("ERROR"),Side::SELL ,OrderType::LIMIT , 60, 15030, Action::NEW},
+        {1617278400000000300, 0, Instrument("AAPL"),parseSide("ERROR") ,OrderType::BAD_INPUT , 0, 0, Action::NEW},
+        {1617278400000000400, 0, Instrument("AAPL"),Side::BUY ,OrderType::BAD_INPUT, 0, 0, Action::MODIFY},
+        {1617278400000000500, 0, Instrument("AAPL"),Side::SELL ,OrderType::BAD_INPUT , 0, 0, Action::CANCEL},
+        {1617278400000000600, 0, Instrument("AAPL"),Side::SELL ,OrderType::BAD_INPUT , 0, 0, Action::CANCEL},
+        {1617278400000000700, 0, Instrument("AAPL"), Side::SELL, OrderType::BAD_INPUT, 0, 0, parseAction("ERROR")}
     };
 
     // Comparaison 
@@ -77,12 +83,12 @@ void testWithBadInputs(){
 
     // Résultat attendu
     std::vector<Order> orders_expected = {
-        {1617278400000000000, 0 ,"AAPL" ,"BUY" ,"BAD_INPUT" , 0, 0, "NEW"},
-        {1617278400000000100, 2,"AAPL" ,"SELL" ,"LIMIT" , 50, 150.25, "NEW"},
-        {1617278400000000200, 3,"USDT" ,"SELL" ,"LIMIT" , 60, 150.3, "NEW"},
-        {1617278400000000300, 4 ,"AAPL" ,"BUY" ,"LIMIT" , 40, 150.2, "NEW"},
-        {1617278400000000400, 0 ,"AAPL" ,"BUY" ,"BAD_INPUT", 0, 0, "TEST"},
-        {1617278400000000500, 0 ,"AAPL" ,"SELL" ,"BAD_INPUT", 0, 0, "CANCEL"}
+        {1617278400000000000, 0 , Instrument("AAPL"),Side::BUY ,OrderType::BAD_INPUT , 0, 0, Action::NEW},
+        {1617278400000000100, 2, Instrument("AAPL"),Side::SELL ,OrderType::LIMIT , 50, 15025, Action::NEW},
+        {1617278400000000200, 3, Instrument("USDT"),Side::SELL ,OrderType::LIMIT , 60, 15030, Action::NEW},
+        {1617278400000000300, 4 , Instrument("AAPL"),Side::BUY ,OrderType::LIMIT , 40, 15020, Action::NEW},
+        {1617278400000000400, 0 , Instrument("AAPL"),Side::BUY ,OrderType::BAD_INPUT, 0, 0, parseAction("TEST")},
+        {1617278400000000500, 0 , Instrument("AAPL"),Side::SELL ,OrderType::BAD_INPUT, 0, 0, Action::CANCEL}
     };
 
         // Comparaison 
@@ -104,11 +110,377 @@ void testWithBadInputs(){
     std::cout << "Test ok" << std::endl;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// Test qui vérifie la conversion exacte des prix texte -> ticks           //
+/////////////////////////////////////////////////////////////////////////////
+
+void testPriceToTicks(){
+
+    std::cout << "Test sur la conversion des prix en ticks " << std::endl;
+
+    CsvReader csvReader;
+
+    // Conversion d'un prix, -1 si le prix est rejeté
+    auto ticks = [&csvReader](std::string_view text, OrderType type, std::string_view instrument) -> Price {
+        Price price = 0;
+        return csvReader.testPrice(text, type, Instrument(instrument), price) == ParseError::NONE ? price : -1;
+    };
+
+    // Tick par défaut (0.01) : conversion exacte, décimales manquantes complétées
+    EXPECT_EQ(ticks("150.25", OrderType::LIMIT, "AAPL"), 15025);
+    EXPECT_EQ(ticks("150.3", OrderType::LIMIT, "AAPL"), 15030);
+    EXPECT_EQ(ticks("150", OrderType::LIMIT, "AAPL"), 15000);
+    EXPECT_EQ(ticks("0.0", OrderType::LIMIT, "AAPL"), 0);
+
+    // Décimales au-delà du tick : arrondi au tick le plus proche
+    EXPECT_EQ(ticks("149.80000001", OrderType::LIMIT, "AAPL"), 14980);
+    EXPECT_EQ(ticks("149.799", OrderType::LIMIT, "AAPL"), 14980);
+
+    // Ordre au marché : prix fixé à 0
+    EXPECT_EQ(ticks("123.45", OrderType::MARKET, "AAPL"), 0);
+
+    // Tick spécifique à un instrument (0.05) : le prix est arrondi au multiple de 0.05 le plus proche
+    TickTable::set("TICK5", TickSize{2, 5});
+    EXPECT_EQ(ticks("10.05", OrderType::LIMIT, "TICK5"), 201);
+    EXPECT_EQ(ticks("10.07", OrderType::LIMIT, "TICK5"), 201);
+
+    // Prix négatif ou non numérique : erreur
+    EXPECT_EQ(ticks("-1", OrderType::LIMIT, "AAPL"), -1);
+    EXPECT_EQ(ticks("abc", OrderType::LIMIT, "AAPL"), -1);
+    EXPECT_EQ(ticks("99999999999999999999", OrderType::LIMIT, "AAPL"), -1);
+
+    // Conversion d'un tick à un autre : arrondi au plus proche, symétrique autour de zéro
+    TickSize cent{2, 1};
+    TickSize five_cents{2, 5};
+    EXPECT_EQ(convertTicks(1007, cent, five_cents), 201);
+    EXPECT_EQ(convertTicks(-1007, cent, five_cents), -201);
+    EXPECT_EQ(convertTicks(1003, cent, five_cents), 201);
+    EXPECT_EQ(convertTicks(-1003, cent, five_cents), -201);
+    EXPECT_EQ(convertTicks(1002, cent, five_cents), 200);
+    EXPECT_EQ(convertTicks(-1002, cent, five_cents), -200);
+    EXPECT_EQ(convertTicks(-15, TickSize{3, 1}, cent), -2);
+    EXPECT_EQ(convertTicks(-201, five_cents, TickSize{3, 1}), -10050);
+
+    std::cout << "Test ok" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Test qui vérifie les rejets des champs numériques, sans exception       //
+/////////////////////////////////////////////////////////////////////////////
+
+// Code d'erreur sous forme d'entier (pour l'affichage par EXPECT_EQ)
+int code(ParseError error){
+    return static_cast<int>(error);
+}
+
+void testNumericFieldErrors(){
+
+    std::cout << "Test sur les codes d'erreur des champs numériques " << std::endl;
+
+    CsvReader csvReader;
+    long long timestamp = 0;
+    int value = 0;
+
+    // Valeurs valides (même tolérance que std::stoll / std::stoi : espaces et signe en tête)
+    EXPECT_EQ(code(csvReader.testTimestamp("1617278400000000000", timestamp)), code(ParseError::NONE));
+    EXPECT_EQ(timestamp, 1617278400000000000LL);
+    EXPECT_EQ(code(csvReader.testId(" +42", value)), code(ParseError::NONE));
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(code(csvReader.testQuantity("15", value)), code(ParseError::NONE));
+    EXPECT_EQ(value, 15);
+
+    // Conversion impossible
+    EXPECT_EQ(code(csvReader.testTimestamp("abc", timestamp)), code(ParseError::BAD_TIMESTAMP));
+    EXPECT_EQ(code(csvReader.testId("", value)), code(ParseError::BAD_ID));
+    EXPECT_EQ(code(csvReader.testQuantity("+-5", value)), code(ParseError::BAD_QUANTITY));
+
+    // Dépassement de capacité (std::stoi levait std::out_of_range, qui n'était pas rattrapée)
+    EXPECT_EQ(code(csvReader.testTimestamp("99999999999999999999", timestamp)), code(ParseError::BAD_TIMESTAMP));
+    EXPECT_EQ(code(csvReader.testId("3000000000", value)), code(ParseError::BAD_ID));
+    EXPECT_EQ(code(csvReader.testQuantity("3000000000", value)), code(ParseError::BAD_QUANTITY));
+
+    // Valeurs hors domaine
+    EXPECT_EQ(code(csvReader.testTimestamp("-1", timestamp)), code(ParseError::BAD_TIMESTAMP));
+    EXPECT_EQ(code(csvReader.testId("0", value)), code(ParseError::BAD_ID));
+    EXPECT_EQ(code(csvReader.testId("-7", value)), code(ParseError::BAD_ID));
+    EXPECT_EQ(code(csvReader.testQuantity("0", value)), code(ParseError::BAD_QUANTITY));
+
+    std::cout << "Test ok" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Test qui vérifie que les vues par actif pointent sur les ordres chargés //
+// (aucune copie) et respectent l'ordre du fichier                        //
+/////////////////////////////////////////////////////////////////////////////
+
+void testInstrumentViews(){
+
+    std::cout << "Test sur les vues des ordres par actif " << std::endl;
+
+    CsvReader csvReader("tests/SimpleOutputs/Inputs/Test2.csv");
+    csvReader.init();
+    const std::vector<Order>& orders = csvReader.getOrders();
+    std::map<std::string, OrderView> views = csvReader.getMapOrder();
+
+    EXPECT_EQ(views.size(), 2);
+    size_t total = 0;
+    for (const auto& [instrument, view] : views) {
+        for (size_t i = 0; i < view.size(); i++) {
+            const Order* order = &view[i];
+            // L'ordre de la vue est celui du tableau des ordres (même adresse)
+            bool in_orders = (order >= orders.data() && order < orders.data() + orders.size());
+            EXPECT_EQ(in_orders, true);
+            EXPECT_EQ(order->instrument.name(), instrument);
+            // Ordre du fichier conservé
+            if (i > 0) {
+                bool file_order = (&view[i - 1] < order);
+                EXPECT_EQ(file_order, true);
+            }
+        }
+        total += view.size();
+    }
+    EXPECT_EQ(total, orders.size());
+
+    std::cout << "Test ok" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Test qui vérifie qu'un même code d'instrument est interné une seule
+// fois (même ID) et que l'ID redonne le nom et le tick de l'instrument
+//////////////////////////////////////////////////////////////////////
+
+void testSymbolTable(){
+
+    std::cout << "Test sur la table des symboles " << std::endl;
+
+    TickTable::set("SYMTEST", TickSize{2, 5});
+    Instrument first("SYMTEST");
+    Instrument second(std::string("SYMTEST"));
+    Instrument other("SYMTEST2");
+    EXPECT_EQ(first.id, second.id);
+    bool distinct = (first != other);
+    EXPECT_EQ(distinct, true);
+    EXPECT_EQ(first.name(), "SYMTEST");
+    EXPECT_EQ(Instrument::fromId(other.id).name(), "SYMTEST2");
+    EXPECT_EQ(first.tick().units, 5);
+    EXPECT_EQ(other.tick().units, DEFAULT_TICK_SIZE.units);
+    EXPECT_EQ(first.isValid(), true);
+    EXPECT_EQ(Instrument().isValid(), false);
+    // ID réservé aux noms refusés par une table pleine : jamais valide (les ordres concernés sont rejetés)
+    EXPECT_EQ(Instrument::fromId(OVERFLOW_INSTRUMENT_ID).isValid(), false);
+
+    // Le tick suit les changements de la TickTable faits après l'internement
+    TickTable::set("SYMTEST2", TickSize{1, 5});
+    EXPECT_EQ(other.tick().decimals, 1);
+    EXPECT_EQ(other.tick().units, 5);
+
+    // Les ordres lus portent l'ID interné
+    CsvReader csvReader("tests/SimpleOutputs/Inputs/Test2.csv");
+    csvReader.init();
+    for (const auto& [instrument, view] : csvReader.getInstrumentViews()) {
+        EXPECT_EQ(instrument.id, Instrument(instrument.name()).id);
+        EXPECT_EQ(view[0].instrument, instrument);
+    }
+
+    std::cout << "Test ok" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Test qui vérifie qu'un fichier converti en colonnes est rechargé
+// à l'identique (lignes invalides et libellés bruts compris)
+//////////////////////////////////////////////////////////////////////
+
+void testColumnsRoundTrip(){
+
+    std::cout << "Test sur la conversion en colonnes " << std::endl;
+
+    CsvReader csvReader("tests/SimpleOutputs/Inputs/Test2.csv");
+    csvReader.init();
+    const std::vector<Order>& orders = csvReader.getOrders();
+
+    // Conversion puis rechargement par le CsvReader (format reconnu automatiquement)
+    std::string columns_file = "build/tests/CSVReader/Test2.cols";
+    OrderColumnsWriter writer(columns_file);
+    EXPECT_EQ(writer.WriteColumns(orders), true);
+    EXPECT_EQ(OrderColumnsFile::isColumnFile(columns_file), true);
+    EXPECT_EQ(OrderColumnsFile::isColumnFile("tests/SimpleOutputs/Inputs/Test2.csv"), false);
+    CsvReader columnsReader(columns_file);
+    columnsReader.init();
+    const std::vector<Order>& reloaded = columnsReader.getOrders();
+
+    EXPECT_EQ(reloaded.size(), orders.size());
+    for (size_t i = 0; i < orders.size(); i++) {
+        EXPECT_EQ(reloaded[i].timestamp, orders[i].timestamp);
+        EXPECT_EQ(reloaded[i].order_id, orders[i].order_id);
+        EXPECT_EQ(reloaded[i].instrument, orders[i].instrument);
+        EXPECT_EQ(reloaded[i].side, orders[i].side);
+        EXPECT_EQ(reloaded[i].type, orders[i].type);
+        EXPECT_EQ(reloaded[i].quantity, orders[i].quantity);
+        EXPECT_EQ(reloaded[i].price, orders[i].price);
+        EXPECT_EQ(reloaded[i].action, orders[i].action);
+    }
+
+    // Mêmes vues par actif
+    std::map<std::string, OrderView> views = csvReader.getMapOrder();
+    std::map<std::string, OrderView> reloaded_views = columnsReader.getMapOrder();
+    EXPECT_EQ(reloaded_views.size(), views.size());
+    for (const auto& [instrument, view] : views) {
+        EXPECT_EQ(reloaded_views.at(instrument).size(), view.size());
+    }
+
+    // Le fichier garde ses ticks : ouvert après un changement de tick, ses prix sont convertis dans
+    // le nouveau tick et la TickTable n'est pas modifiée
+    TickTable::set("COLTICK", TickSize{2, 5});
+    std::vector<Order> tick_orders = {Order{1, 1, Instrument("COLTICK"), Side::BUY, OrderType::LIMIT, 10, 30, Action::NEW}};
+    std::string tick_file = "build/tests/CSVReader/Ticks.cols";
+    EXPECT_EQ(OrderColumnsWriter(tick_file).WriteColumns(tick_orders), true);
+    TickTable::set("COLTICK", TickSize{2, 1});
+    {
+        OrderColumnsFile columns(tick_file);
+        EXPECT_EQ(columns.isValid(), true);
+        EXPECT_EQ(columns.fileTick(0).units, 5);
+        EXPECT_EQ(columns.price(0), 150);
+        EXPECT_EQ(TickTable::get("COLTICK").units, 1);
+    }
+
+    // Fichiers corrompus, tous refusés à l'ouverture : varint de timestamp non terminé, code de côté inconnu,
+    // position de colonne qui déborde ou qui n'est pas alignée
+    std::string valid_bytes;
+    {
+        std::ifstream input(columns_file, std::ios::binary);
+        valid_bytes.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    }
+    OrderColumnsHeader valid_header;
+    std::memcpy(&valid_header, valid_bytes.data(), sizeof(valid_header));
+    std::string corrupted_file = "build/tests/CSVReader/Corrupted.cols";
+    auto isValidAfter = [&](const std::function<void(std::string&, OrderColumnsHeader&)>& corrupt) {
+        std::string bytes = valid_bytes;
+        OrderColumnsHeader header = valid_header;
+        corrupt(bytes, header);
+        std::memcpy(&bytes[0], &header, sizeof(header));
+        {
+            std::ofstream output(corrupted_file, std::ios::binary);
+            output.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+        OrderColumnsFile corrupted(corrupted_file);
+        return corrupted.isValid() || corrupted.size() != 0;
+    };
+    EXPECT_EQ(isValidAfter([](std::string& bytes, OrderColumnsHeader& header) {
+        for (uint64_t i = 0; i < header.timestamp_bytes; i++) {
+            bytes[header.timestamp_offset + i] = static_cast<char>(0x80);
+        }
+    }), false);
+    EXPECT_EQ(isValidAfter([](std::string& bytes, OrderColumnsHeader& header) {
+        bytes[header.side_offset] = 5;
+    }), false);
+    EXPECT_EQ(isValidAfter([](std::string&, OrderColumnsHeader& header) {
+        header.price_offset = UINT64_MAX - 7;
+    }), false);
+    EXPECT_EQ(isValidAfter([](std::string&, OrderColumnsHeader& header) {
+        header.price_offset += 4;
+    }), false);
+
+    std::cout << "Test ok" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Test qui vérifie que le générateur de flux est reproductible et que
+// ses ordres sont relus à l'identique par le CsvReader
+//////////////////////////////////////////////////////////////////////
+
+void testGeneratedFlow(){
+
+    std::cout << "Test sur le générateur de flux d'ordres " << std::endl;
+
+    OrderFlowConfig config;
+    config.seed = 7;
+    config.instrument_count = 12;
+    OrderFlowGenerator generator(config);
+    OrderFlowGenerator same_generator(config);
+
+    std::vector<Order> orders;
+    std::string csv = "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    for (int i = 0; i < 5000; i++) {
+        orders.push_back(generator.next());
+        Order same = same_generator.next();
+        EXPECT_EQ(same.order_id, orders.back().order_id);
+        EXPECT_EQ(same.price, orders.back().price);
+        EXPECT_EQ(same.instrument, orders.back().instrument);
+        OrderFlowGenerator::appendCsvRow(orders.back(), csv);
+        csv += '\n';
+    }
+
+    std::string csv_file = "build/tests/CSVReader/generated.csv";
+    std::ofstream(csv_file, std::ios::binary) << csv;
+    CsvReader csvReader(csv_file);
+    csvReader.init();
+    const std::vector<Order>& reloaded = csvReader.getOrders();
+
+    // Aucun ordre invalide, timestamps croissants
+    EXPECT_EQ(reloaded.size(), orders.size());
+    for (size_t i = 0; i < orders.size(); i++) {
+        EXPECT_EQ(reloaded[i].type, orders[i].type);
+        EXPECT_EQ(reloaded[i].timestamp, orders[i].timestamp);
+        EXPECT_EQ(reloaded[i].instrument, orders[i].instrument);
+        EXPECT_EQ(reloaded[i].quantity, orders[i].quantity);
+        int64_t expected_price = orders[i].type == OrderType::MARKET ? 0 : orders[i].price;
+        EXPECT_EQ(reloaded[i].price, expected_price);
+        EXPECT_EQ(reloaded[i].action, orders[i].action);
+        bool increasing = i == 0 || orders[i].timestamp > orders[i - 1].timestamp;
+        EXPECT_EQ(increasing, true);
+    }
+    EXPECT_EQ(csvReader.getMapOrder().size(), config.instrument_count);
+
+    std::cout << "Test ok" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Test qui vérifie qu'une table des libellés bruts pleine ne donne jamais
+// le code d'un autre libellé, et qu'un code inconnu s'affiche sans erreur
+// (remplit la table du processus : à lancer en dernier)
+//////////////////////////////////////////////////////////////////////
+
+void testRawLabelsOverflow(){
+
+    std::cout << "Test sur la table des libellés bruts pleine " << std::endl;
+
+    // Un code hors de la table (ou entre les valeurs connues et FIRST_RAW_LABEL) a un libellé de repli
+    std::string unknown_side = toLabel(static_cast<Side>(5));
+    std::string unknown_action = toLabel(static_cast<Action>(200));
+    EXPECT_EQ(unknown_side, UNKNOWN_RAW_LABEL);
+    EXPECT_EQ(unknown_action, UNKNOWN_RAW_LABEL);
+    EXPECT_EQ(RawLabels::contains(5), false);
+
+    // Remplissage : chaque libellé accepté a son propre code, les suivants reçoivent OVERFLOW_RAW_LABEL
+    uint8_t last_code = 0;
+    for (int i = 0; i < 300; i++) {
+        uint8_t code = RawLabels::intern("RAW_" + std::to_string(i));
+        if (code == OVERFLOW_RAW_LABEL) {
+            break;
+        }
+        EXPECT_EQ(RawLabels::get(code), "RAW_" + std::to_string(i));
+        last_code = code;
+    }
+    EXPECT_EQ(last_code, OVERFLOW_RAW_LABEL - 1);
+    EXPECT_EQ(RawLabels::intern("RAW_OVERFLOW"), OVERFLOW_RAW_LABEL);
+    std::string overflow_label = toLabel(parseSide("RAW_OVERFLOW"));
+    EXPECT_EQ(overflow_label, UNKNOWN_RAW_LABEL);
+
+    std::cout << "Test ok" << std::endl;
+}
+
 int main() {
     std::cout << "\n=== TESTS UNITAIRES - CAS LIMITES TRAITES PAR LE MATCHING ENGINE ===\n" << std::endl;
 
     testOnlyBadInputs();
     testWithBadInputs();
+    testPriceToTicks();
+    testNumericFieldErrors();
+    testInstrumentViews();
+    testSymbolTable();
+    testColumnsRoundTrip();
+    testGeneratedFlow();
+    testRawLabelsOverflow();
 
     std::cout << "TOUS LES TESTS ONT ETE PASSES AVEC SUCCES !" << std::endl;
     return 0;
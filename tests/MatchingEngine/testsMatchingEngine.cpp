@@ -1,10 +1,38 @@
 // FICHIER DE TESTS SUR LA LOGIQUE ET LES EXCEPTIONS DU MATCHING ENGINE
 // On s'attache à suivre la structure classique "GIVEN - WHEN - THEN"
+// Les prix sont exprimés en ticks (tick par défaut : 0.01, donc 15000 correspond à 150.00)
 
 #include "core/MatchingEngine.h"
+#include "utils/LatencyHistogram.h"
 #include <iostream>
 #include <vector>
 #include <cassert>
+#include <random>
+#include <unordered_map>
+#include <map>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+// Compteur des allocations du thread courant (remplacement de l'opérateur new global) :
+// permet de vérifier qu'une séquence d'opérations ne fait aucune allocation
+thread_local size_t allocation_count = 0;
+
+void* operator new(std::size_t size) {
+    allocation_count++;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
 
 // Macros de test : une de comparaison, une de vérité
 #define EXPECT_EQ(actual, expected) \
@@ -33,9 +61,9 @@ void testModifyQtyNotNeg() {
 
     // GIVEN (ordre partiellement exécuté et sa modification substantielle)
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "BUY", "LIMIT", 50, 150.0, "NEW"},
-        {2000, 2, "AAPL", "SELL", "LIMIT", 20, 150.0, "NEW"},
-        {3000, 1, "AAPL", "BUY", "LIMIT", 10, 151.0, "MODIFY"}
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 50, 15000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 20, 15000, Action::NEW},
+        {3000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 15100, Action::MODIFY}
     };
 
      // WHEN (processus de matching)
@@ -44,8 +72,8 @@ void testModifyQtyNotNeg() {
     // THEN (le MODIFY doit transformer l'ordre en un ordre exécuté)
     bool modify_found = false;
     for (const auto& result : results) {
-        if (result.original_order.order_id == 1 && result.original_order.action == "MODIFY") {
-            EXPECT_EQ(result.status, "EXECUTED");
+        if (result.original_order.order_id == 1 && result.original_order.action == Action::MODIFY) {
+            EXPECT_EQ(result.status, OrderStatus::EXECUTED);
             EXPECT_EQ(result.original_order.quantity, 0);
             modify_found = true;
         }
@@ -65,8 +93,8 @@ void testIdNoDuplicatePossible() {
     MatchingEngine engine;
     // GIVEN : deux ordres avec le même ID et action NEW
     std::vector<Order> orders = {
-        {1000, 123, "AAPL", "BUY", "LIMIT", 100, 150.0, "NEW"},
-        {2000, 123, "AAPL", "SELL", "LIMIT", 50, 151.0, "NEW"}
+        {1000, 123, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 100, 15000, Action::NEW},
+        {2000, 123, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 50, 15100, Action::NEW}
     };
 
     // WHEN : quand ils entrent dans le matching engine
@@ -74,8 +102,8 @@ void testIdNoDuplicatePossible() {
 
     // THEN : le second est rejeté
     EXPECT_EQ(results.size(), 2);
-    EXPECT_EQ(results[0].status, "PENDING");
-    EXPECT_EQ(results[1].status, "REJECTED");
+    EXPECT_EQ(results[0].status, OrderStatus::PENDING);
+    EXPECT_EQ(results[1].status, OrderStatus::REJECTED);
 
     std::cout << "PASS : ID non dupliqué pour NEW\n";
 }
@@ -91,8 +119,8 @@ void testRejectModifyWithInexistantID() {
 
     // GIVEN : un nouvel ordre et un ordre de modification avec un ID inexistant
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "BUY", "LIMIT", 100, 150.0, "NEW"},
-        {2000, 999, "AAPL", "BUY", "LIMIT", 50, 151.0, "MODIFY"}
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 100, 15000, Action::NEW},
+        {2000, 999, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 50, 15100, Action::MODIFY}
     };
 
     // WHEN : entrée dans le matching engine
@@ -101,8 +129,8 @@ void testRejectModifyWithInexistantID() {
     // THEN : le statut de l'ordre doit être "REJECTED"
     bool modify_rejected = false;
     for (const auto& result : results) {
-        if (result.original_order.order_id == 999 && result.original_order.action == "MODIFY") {
-            EXPECT_EQ(result.status, "REJECTED");
+        if (result.original_order.order_id == 999 && result.original_order.action == Action::MODIFY) {
+            EXPECT_EQ(result.status, OrderStatus::REJECTED);
             modify_rejected = true;
         }
     }
@@ -121,16 +149,16 @@ void testRejectCancelWithInexistantID() {
     MatchingEngine engine;
 
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "BUY", "LIMIT", 100, 150.0, "NEW"},
-        {2000, 999, "AAPL", "BUY", "LIMIT", 0, 0, "CANCEL"}
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 100, 15000, Action::NEW},
+        {2000, 999, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL}
     };
 
     auto results = engine.processAllOrders(orders);
 
     bool cancel_rejected = false;
     for (const auto& result : results) {
-        if (result.original_order.order_id == 999 && result.original_order.action == "CANCEL") {
-            EXPECT_EQ(result.status, "REJECTED");
+        if (result.original_order.order_id == 999 && result.original_order.action == Action::CANCEL) {
+            EXPECT_EQ(result.status, OrderStatus::REJECTED);
             cancel_rejected = true;
         }
     }
@@ -149,7 +177,7 @@ void testRejectMarketIfNoCounterparty() {
 
     // GIVEN : un ordre au marché seul
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "BUY", "MARKET", 100, 0, "NEW"}
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 100, 0, Action::NEW}
     };
 
     // WHEN : entrée dans le matching engine (ne peut pas matcher par définition)
@@ -157,7 +185,7 @@ void testRejectMarketIfNoCounterparty() {
 
     // THEN : le statut de l'ordre = rejeté
     EXPECT_EQ(results.size(), 1);
-    EXPECT_EQ(results[0].status, "REJECTED");
+    EXPECT_EQ(results[0].status, OrderStatus::REJECTED);
 
     std::cout << "PASS : MARKET order sans contrepartie rejeté\n";
 }
@@ -172,8 +200,8 @@ void testExecuteMarketIfCounterparty() {
 
     // GIVEN : un ordre de vente limite qui reste au carnet et un ordre d'achat au marché de quantité plus faible (qui doit donc matcher)
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "SELL", "LIMIT", 50, 150.0, "NEW"},
-        {2000, 2, "AAPL", "BUY", "MARKET", 30, 0, "NEW"}
+        {1000, 1, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 50, 15000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 30, 0, Action::NEW}
     };
 
     // WHEN : entrée dans le matching engine
@@ -182,10 +210,10 @@ void testExecuteMarketIfCounterparty() {
     // THEN : il doit être exécuté 
     bool market_executed = false;
     for (const auto& result : results) {
-        if (result.original_order.order_id == 2 && result.original_order.action == "NEW") {
-            EXPECT_EQ(result.status, "EXECUTED");
+        if (result.original_order.order_id == 2 && result.original_order.action == Action::NEW) {
+            EXPECT_EQ(result.status, OrderStatus::EXECUTED);
             EXPECT_EQ(result.executed_quantity, 30);
-            EXPECT_EQ(result.execution_price, 150.0);
+            EXPECT_EQ(result.execution_price, 15000);
             market_executed = true;
         }
     }
@@ -204,7 +232,7 @@ void testRejectIfBadInput() {
 
     // GIVEN (ordre avec bad_input)
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "BUY", "BAD_INPUT", 100, 150.0, "NEW"}
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::BAD_INPUT, 100, 15000, Action::NEW}
     };
 
     // WHEN : entrée dans le matching engine
@@ -212,7 +240,7 @@ void testRejectIfBadInput() {
 
     // THEN : rejet
     EXPECT_EQ(results.size(), 1);
-    EXPECT_EQ(results[0].status, "REJECTED");
+    EXPECT_EQ(results[0].status, OrderStatus::REJECTED);
 
     std::cout << "PASS : Type BAD_INPUT automatiquement rejeté\n";
 }
@@ -226,26 +254,737 @@ void testMultipleCases() {
     MatchingEngine engine;
 
     std::vector<Order> orders = {
-        {1000, 1, "AAPL", "BUY", "LIMIT", 100, 150.0, "NEW"},
-        {2000, 2, "AAPL", "SELL", "LIMIT", 60, 150.0, "NEW"},
-        {3000, 1, "AAPL", "BUY", "LIMIT", 50, 151.0, "NEW"},
-        {4000, 1, "AAPL", "BUY", "LIMIT", 10, 152.0, "MODIFY"},
-        {5000, 3, "AAPL", "BUY", "MARKET", 50, 0, "NEW"},
-        {6000, 4, "AAPL", "SELL", "BAD_INPUT", 25, 145.0, "NEW"},
-        {7000, 999, "AAPL", "BUY", "LIMIT", 0, 0, "CANCEL"}
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 100, 15000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 60, 15000, Action::NEW},
+        {3000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 50, 15100, Action::NEW},
+        {4000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 15200, Action::MODIFY},
+        {5000, 3, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 50, 0, Action::NEW},
+        {6000, 4, Instrument("AAPL"), Side::SELL, OrderType::BAD_INPUT, 25, 14500, Action::NEW},
+        {7000, 999, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL}
     };
 
     auto results = engine.processAllOrders(orders);
 
     int rejected_count = 0;
     for (const auto& result : results) {
-        if (result.status == "REJECTED") rejected_count++;
+        if (result.status == OrderStatus::REJECTED) rejected_count++;
     }
 
     EXPECT_EQ(rejected_count, 4);
     std::cout << "PASS : Scénario complexe qui rejette tout\n";
 }
 
+// ###########################################################################################################
+// Test qui vérifie qu'un ordre annulé ou modifié est réellement retiré du carnet : un ordre entrant ne doit
+// jamais être exécuté contre l'ordre annulé, ni contre l'ancienne version (prix / quantité) d'un ordre modifié.
+// ###########################################################################################################
+void testCanceledOrModifiedOrderNeverMatches() {
+    std::cout << "Test de retrait effectif des ordres annulés / modifiés" << std::endl;
+
+    MatchingEngine engine;
+
+    // GIVEN : un ordre de vente annulé, un ordre de vente modifié (prix relevé), puis un achat au marché
+    std::vector<Order> orders = {
+        {1000, 1, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 50, 15000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 40, 15100, Action::NEW},
+        {3000, 1, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 50, 15000, Action::CANCEL},
+        {4000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 40, 15500, Action::MODIFY},
+        {5000, 3, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 100, 0, Action::NEW}
+    };
+
+    // WHEN : entrée dans le matching engine
+    auto results = engine.processAllOrders(orders);
+
+    // THEN : l'achat ne rencontre que l'ordre 2, à son nouveau prix
+    int fills = 0;
+    for (const auto& result : results) {
+        if (result.original_order.order_id == 3) {
+            EXPECT_EQ(result.counterparty_id, 2);
+            EXPECT_EQ(result.execution_price, 15500);
+            EXPECT_EQ(result.executed_quantity, 40);
+            fills++;
+        }
+    }
+    EXPECT_EQ(fills, 1);
+    std::cout << "PASS : Les ordres annulés / modifiés ne sont plus matchés\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie que l'index des ordres (table de hachage à adressage ouvert) reste cohérent après un grand
+// nombre d'insertions / suppressions aléatoires (agrandissements et suppressions par décalage compris),
+// en le comparant à une std::unordered_map.
+// ###########################################################################################################
+void testOrderIndexConsistency() {
+    std::cout << "Test de cohérence de l'index des ordres" << std::endl;
+
+    // GIVEN : un index volontairement petit (pour forcer les agrandissements) et une référence
+    OrderIndex index(16);
+    std::unordered_map<int, OrderHandle> reference;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> id_dist(-5000, 5000);
+
+    // WHEN : opérations aléatoires
+    for (int i = 0; i < 200000; i++) {
+        int id = id_dist(rng);
+        if (rng() % 3 == 0) {
+            bool erased = index.erase(id);
+            bool expected_erased = (reference.erase(id) == 1);
+            EXPECT_EQ(erased, expected_erased);
+        } else {
+            OrderHandle handle = static_cast<OrderHandle>(i);
+            index.insert(id, handle);
+            reference[id] = handle;
+        }
+    }
+
+    // THEN : mêmes contenus
+    EXPECT_EQ(index.size(), reference.size());
+    for (int id = -5000; id <= 5000; id++) {
+        auto it = reference.find(id);
+        OrderHandle expected = (it == reference.end()) ? NULL_HANDLE : it->second;
+        EXPECT_EQ(index.find(id), expected);
+    }
+    std::cout << "PASS : Index des ordres cohérent\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie le calcul de la quantité d'un MODIFY à partir de la quantité initiale de l'ordre NEW,
+// y compris après une exécution partielle et sur plusieurs MODIFY successifs.
+// Ex : NEW 100, exécution de 30 (reste 70), MODIFY à 80 -> réduction de 20 -> reste 50,
+// puis MODIFY à 60 -> réduction de 40 par rapport aux 100 initiaux -> reste 10.
+// ###########################################################################################################
+void testSuccessiveModifyUseInitialQuantity() {
+    std::cout << "Test de MODIFY successifs après exécution partielle" << std::endl;
+
+    MatchingEngine engine;
+
+    // GIVEN : un ordre partiellement exécuté puis modifié deux fois
+    std::vector<Order> orders = {
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 100, 15000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 30, 15000, Action::NEW},
+        {3000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 80, 14900, Action::MODIFY},
+        {4000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 60, 14900, Action::MODIFY}
+    };
+
+    // WHEN : entrée dans le matching engine
+    auto results = engine.processAllOrders(orders);
+
+    // THEN : les deux MODIFY laissent respectivement 50 puis 10 au carnet
+    std::vector<int> modify_quantities;
+    for (const auto& result : results) {
+        if (result.original_order.order_id == 1 && result.original_order.action == Action::MODIFY) {
+            EXPECT_EQ(result.status, OrderStatus::PENDING);
+            modify_quantities.push_back(result.original_order.quantity);
+        }
+    }
+    EXPECT_EQ(modify_quantities.size(), 2);
+    EXPECT_EQ(modify_quantities[0], 50);
+    EXPECT_EQ(modify_quantities[1], 10);
+    std::cout << "PASS : MODIFY successifs calculés sur la quantité initiale\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie que les buffers de matching (réutilisés d'un ordre à l'autre) sont bien remis à zéro :
+// un ordre qui balaie plusieurs niveaux puis un second ordre qui croise ne doivent produire que leurs propres lignes.
+// ###########################################################################################################
+void testMatchBuffersResetBetweenOrders() {
+    std::cout << "Test de la remise à zéro des buffers de matching" << std::endl;
+
+    MatchingEngine engine;
+
+    // GIVEN : trois niveaux de vente, un achat qui en balaie deux, puis un achat qui prend le reste
+    std::vector<Order> orders = {
+        {1000, 1, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 10, 15000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 10, 15100, Action::NEW},
+        {3000, 3, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 10, 15200, Action::NEW},
+        {4000, 4, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 20, 15100, Action::NEW},
+        {5000, 5, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 5, 0, Action::NEW}
+    };
+
+    // WHEN : entrée dans le matching engine
+    auto results = engine.processAllOrders(orders);
+
+    // THEN : 3 PENDING, 2 trades + 2 impacts pour l'ordre 4, 1 trade + 1 impact pour l'ordre 5
+    EXPECT_EQ(results.size(), 9);
+    int lines_at_5000 = 0;
+    for (const auto& result : results) {
+        if (result.original_order.timestamp == 5000) {
+            lines_at_5000++;
+        }
+    }
+    EXPECT_EQ(lines_at_5000, 2);
+    EXPECT_EQ(results[7].original_order.order_id, 5);
+    EXPECT_EQ(results[7].status, OrderStatus::EXECUTED);
+    EXPECT_EQ(results[7].execution_price, 15200);
+    EXPECT_EQ(results[8].original_order.order_id, 3);
+    EXPECT_EQ(results[8].status, OrderStatus::PARTIALLY_EXECUTED);
+    EXPECT_EQ(results[8].original_order.quantity, 5);
+    std::cout << "PASS : buffers de matching remis à zéro entre deux ordres\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie qu'une vue non triée (indices dans le désordre) est traitée dans l'ordre chronologique,
+// sans modifier le tableau des ordres
+// ###########################################################################################################
+void testUnsortedViewIsProcessedChronologically() {
+    std::cout << "Test du traitement d'une vue non triée" << std::endl;
+
+    MatchingEngine engine;
+
+    // GIVEN : deux actifs mélangés, et une vue sur les ordres AAPL donnée dans le désordre
+    std::vector<Order> orders = {
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 50, 15000, Action::NEW},
+        {1500, 7, Instrument("MSFT"), Side::SELL, OrderType::LIMIT, 10, 30000, Action::NEW},
+        {2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 20, 15000, Action::NEW},
+        {3000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL}
+    };
+    std::vector<uint32_t> aapl_indices = {3, 2, 0};
+
+    // WHEN : entrée de la vue dans le matching engine
+    auto results = engine.processAllOrders(OrderView(orders, aapl_indices));
+
+    // THEN : NEW 1 (PENDING), NEW 2 exécuté contre 1, CANCEL du reliquat de 1
+    EXPECT_EQ(results.size(), 4);
+    EXPECT_EQ(results[0].original_order.order_id, 1);
+    EXPECT_EQ(results[0].status, OrderStatus::PENDING);
+    EXPECT_EQ(results[1].original_order.order_id, 2);
+    EXPECT_EQ(results[1].status, OrderStatus::EXECUTED);
+    EXPECT_EQ(results[2].original_order.order_id, 1);
+    EXPECT_EQ(results[2].status, OrderStatus::PARTIALLY_EXECUTED);
+    EXPECT_EQ(results[3].status, OrderStatus::CANCELED);
+    // Le tableau d'origine n'est pas modifié
+    EXPECT_EQ(orders[3].action, Action::CANCEL);
+    EXPECT_EQ(aapl_indices[0], 3);
+    std::cout << "PASS : vue non triée traitée dans l'ordre chronologique\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie qu'en régime établi (capacités réservées par EngineConfig), les opérations sur le carnet
+// ne font aucune allocation : noeuds des ordres et des niveaux de prix recyclés, index et historique réservés
+// ###########################################################################################################
+
+void testNoAllocationInSteadyState() {
+    std::cout << "Test d'absence d'allocation en régime établi" << std::endl;
+
+    // GIVEN (un engine dimensionné pour 1000 ordres au repos, 100 niveaux et 20000 résultats)
+    EngineConfig config;
+    config.order_capacity = 1000;
+    config.level_capacity = 100;
+    config.result_capacity = 20000;
+    MatchingEngine engine(config);
+
+    // Flux : ordres passifs sur 40 niveaux, annulations, modifications et ordres qui croisent
+    std::vector<Order> orders;
+    int next_id = 1;
+    for (int round = 0; round < 20; round++) {
+        int first_id = next_id;
+        for (int i = 0; i < 200; i++) {
+            Side side = (i % 2 == 0) ? Side::BUY : Side::SELL;
+            Price price = (side == Side::BUY) ? 15000 - i % 20 : 15001 + i % 20;
+            orders.push_back({1000, next_id++, Instrument("AAPL"), side, OrderType::LIMIT, 10, price, Action::NEW});
+        }
+        for (int i = 0; i < 50; i++) {
+            const Order& target = orders[orders.size() - 200 + 2 * i];
+            orders.push_back({1000, target.order_id, Instrument("AAPL"), target.side, OrderType::LIMIT, 5, target.price - 1,
+                              Action::MODIFY});
+        }
+        for (int i = 0; i < 50; i++) {
+            orders.push_back({1000, first_id + 2 * i + 101, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 10, 0,
+                              Action::CANCEL});
+        }
+        // Balayage des deux côtés : le carnet est vidé, tous les niveaux sont supprimés
+        orders.push_back({1000, next_id++, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 100000, 0, Action::NEW});
+        orders.push_back({1000, next_id++, Instrument("AAPL"), Side::SELL, OrderType::MARKET, 100000, 0, Action::NEW});
+    }
+
+    // WHEN (un premier passage amorce les réserves, le second est mesuré)
+    size_t half = orders.size() / 2;
+    for (size_t i = 0; i < half; i++) {
+        engine.processOrder(orders[i]);
+    }
+    size_t allocations_before = allocation_count;
+    for (size_t i = half; i < orders.size(); i++) {
+        engine.processOrder(orders[i]);
+    }
+    size_t allocations = allocation_count - allocations_before;
+
+    // THEN
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_TRUE(engine.getResults().size() > orders.size());
+    std::cout << "PASS : aucune allocation sur " << orders.size() - half << " ordres\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie, ordre par ordre, l'absence d'allocation sur l'entrée par span (engine sans historique,
+// résultats écrits dans une table de l'appelant) pour chaque type de flux : NEW, MODIFY, CANCEL et exécutions
+// ###########################################################################################################
+
+enum Flow { FLOW_NEW, FLOW_MODIFY, FLOW_CANCEL, FLOW_FILL, FLOW_COUNT };
+
+// Un cycle complet : le carnet est rempli, modifié, en partie annulé puis entièrement vidé par des exécutions
+void appendCycle(std::vector<Order>& orders, std::vector<Flow>& flows, int& next_id) {
+    int first_id = next_id;
+    for (int i = 0; i < 100; i++) {
+        Side side = (i % 2 == 0) ? Side::BUY : Side::SELL;
+        Price price = (side == Side::BUY) ? 15000 - i % 10 : 15001 + i % 10;
+        orders.push_back({1000, next_id++, Instrument("AAPL"), side, OrderType::LIMIT, 10, price, Action::NEW});
+        flows.push_back(FLOW_NEW);
+    }
+    for (int i = 0; i < 20; i++) {
+        orders.push_back({1000, first_id + 2 * i, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 5 + i % 3, 14995 - i % 5,
+                          Action::MODIFY});
+        flows.push_back(FLOW_MODIFY);
+    }
+    for (int i = 0; i < 20; i++) {
+        orders.push_back({1000, first_id + 2 * i + 1, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 0, 0, Action::CANCEL});
+        flows.push_back(FLOW_CANCEL);
+    }
+    // Vente agressive (exécutions contre tous les achats, reliquat au carnet), puis achat au marché qui vide le carnet
+    orders.push_back({1000, next_id++, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 100000, 14900, Action::NEW});
+    flows.push_back(FLOW_FILL);
+    orders.push_back({1000, next_id++, Instrument("AAPL"), Side::BUY, OrderType::MARKET, 1000000, 0, Action::NEW});
+    flows.push_back(FLOW_FILL);
+}
+
+void testNoAllocationPerOrderByFlow() {
+    std::cout << "Test d'absence d'allocation par ordre (entrée par span)" << std::endl;
+
+    // GIVEN : un engine sans historique et une table de résultats de l'appelant, réservée
+    EngineConfig config;
+    config.order_capacity = 256;
+    config.level_capacity = 64;
+    config.keep_history = false;
+    MatchingEngine engine(config);
+    ResultTable out;
+    out.reserve(4096);
+
+    std::vector<Order> orders;
+    std::vector<Flow> flows;
+    int next_id = 1;
+    appendCycle(orders, flows, next_id);
+    size_t warmup = orders.size();
+    appendCycle(orders, flows, next_id);
+
+    // WHEN : un premier cycle amorce les buffers, le second est mesuré ordre par ordre
+    engine.processOrders(OrderView(orders.data(), warmup), out);
+    out.clear();
+    size_t allocations[FLOW_COUNT] = {};
+    size_t processed[FLOW_COUNT] = {};
+    for (size_t i = warmup; i < orders.size(); i++) {
+        size_t before = allocation_count;
+        engine.processOrders(OrderView(&orders[i], 1), out);
+        allocations[flows[i]] += allocation_count - before;
+        processed[flows[i]]++;
+    }
+
+    // THEN : aucune allocation, quel que soit le flux, et les résultats sont dans la table de l'appelant
+    for (int flow = 0; flow < FLOW_COUNT; flow++) {
+        EXPECT_TRUE(processed[flow] > 0);
+        EXPECT_EQ(allocations[flow], 0u);
+    }
+    EXPECT_TRUE(engine.getResults().empty());
+    EXPECT_TRUE(out.size() > orders.size() - warmup);
+
+    // Transfert sans copie de l'historique d'un engine vers une table vide
+    MatchingEngine history_engine;
+    history_engine.processAllOrders(OrderView(orders.data(), warmup));
+    size_t history_size = history_engine.getResults().size();
+    ResultTable drained;
+    history_engine.drainResults(drained);
+    EXPECT_EQ(drained.size(), history_size);
+    EXPECT_TRUE(history_engine.getResults().empty());
+
+    // Avec historique : les résultats écrits dans la table de l'appelant sont aussi gardés par l'engine
+    MatchingEngine kept_engine;
+    ResultTable kept_out;
+    size_t kept = kept_engine.processOrders(OrderView(orders.data(), warmup), kept_out);
+    EXPECT_EQ(kept, history_size);
+    EXPECT_EQ(kept_engine.getResults().size(), history_size);
+    EXPECT_EQ(kept_out.orderId(kept - 1), kept_engine.getResults().orderId(kept - 1));
+    std::cout << "PASS : aucune allocation sur " << orders.size() - warmup << " ordres (NEW, MODIFY, CANCEL, exécutions)\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie que l'historique en colonnes conserve toutes les lignes au passage d'un bloc à l'autre,
+// et qu'une vue prise avant de nouveaux ajouts reste valide (les blocs ne sont jamais déplacés)
+// ###########################################################################################################
+
+void testResultTableChunks() {
+    std::cout << "Test de l'historique en colonnes" << std::endl;
+
+    // GIVEN : plus de deux blocs de résultats
+    ResultTable table;
+    size_t count = 2 * ResultTable::CHUNK_SIZE + 10;
+    for (size_t i = 0; i < ResultTable::CHUNK_SIZE; i++) {
+        Order order{static_cast<long long>(i), static_cast<int>(i), Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 15000, Action::NEW};
+        table.append(order, OrderStatus::PENDING);
+    }
+    ResultView first_chunk = table.view();
+    OrderResult last_before = first_chunk[ResultTable::CHUNK_SIZE - 1];
+    const ResultTable::Chunk* chunk_address = &table.chunk(0);
+
+    // WHEN : ajouts au-delà du premier bloc
+    for (size_t i = ResultTable::CHUNK_SIZE; i < count; i++) {
+        Order order{static_cast<long long>(i), static_cast<int>(i), Instrument("MSFT"), Side::SELL, OrderType::LIMIT, 5, 30000, Action::NEW};
+        table.append(order, OrderStatus::EXECUTED, 5, 29900, 7);
+    }
+
+    // THEN : colonnes et lignes reconstituées conformes, vue et bloc inchangés
+    EXPECT_EQ(table.size(), count);
+    EXPECT_EQ(table.chunkCount(), 3u);
+    EXPECT_TRUE(&table.chunk(0) == chunk_address);
+    EXPECT_EQ(first_chunk.size(), ResultTable::CHUNK_SIZE);
+    EXPECT_EQ(first_chunk[ResultTable::CHUNK_SIZE - 1].original_order.order_id, last_before.original_order.order_id);
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(table.orderId(i), static_cast<int>(i));
+        EXPECT_EQ(table.timestamp(i), static_cast<long long>(i));
+    }
+    OrderResult last = table[count - 1];
+    EXPECT_EQ(last.original_order.instrument.name(), "MSFT");
+    EXPECT_EQ(last.status, OrderStatus::EXECUTED);
+    EXPECT_EQ(last.execution_price, 29900);
+    EXPECT_EQ(last.counterparty_id, 7);
+    ResultView tail = table.view(count - 10, count);
+    size_t seen = 0;
+    for (const OrderResult& result : tail) {
+        EXPECT_EQ(result.original_order.side, Side::SELL);
+        seen++;
+    }
+    EXPECT_EQ(seen, 10u);
+
+    // Vidage : les blocs sont gardés
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.capacity(), 3 * ResultTable::CHUNK_SIZE);
+    std::cout << "PASS : historique en colonnes sur " << count << " résultats\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie que les abonnés (variante virtuelle et variante template) reçoivent chaque résultat,
+// au fil du traitement, avec le bon événement, et qu'un engine sans historique ne garde rien
+// ###########################################################################################################
+
+// Compteurs d'événements, variante virtuelle
+struct CountingListener : public EngineListener {
+    int accepted = 0, modified = 0, filled = 0, partially_filled = 0, canceled = 0, rejected = 0;
+    void onAccepted(const OrderResult&) override { accepted++; }
+    void onModified(const OrderResult&) override { modified++; }
+    void onFilled(const OrderResult&) override { filled++; }
+    void onPartiallyFilled(const OrderResult&) override { partially_filled++; }
+    void onCanceled(const OrderResult&) override { canceled++; }
+    void onRejected(const OrderResult&) override { rejected++; }
+};
+
+// Variante template : seules les exécutions sont suivies, le reste passe par onResult
+struct FillListener : public StaticListener<FillListener> {
+    int fills = 0, others = 0;
+    void onFilled(const OrderResult&) { fills++; }
+    void onPartiallyFilled(const OrderResult&) { fills++; }
+    void onResult(const OrderResult&) { others++; }
+};
+
+void testListenerEvents() {
+    std::cout << "Test des abonnés aux événements" << std::endl;
+
+    // GIVEN : un flux qui produit chacun des événements
+    std::vector<Order> orders = {
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 50, 15000, Action::NEW},       // accepté
+        {2000, 2, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 14900, Action::NEW},       // accepté
+        {3000, 2, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 20, 14950, Action::MODIFY},    // modifié
+        {4000, 3, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 20, 15000, Action::NEW},      // exécuté + 1 partiel
+        {5000, 2, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL},         // annulé
+        {6000, 9, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL}          // rejeté
+    };
+
+    // WHEN : traitement avec un abonné enregistré, et en parallèle un abonné template sans historique
+    MatchingEngine engine;
+    CountingListener counts;
+    int results_seen_during_processing = 0;
+    engine.setListener(&counts);
+    for (const Order& order : orders) {
+        engine.processOrder(order);
+        results_seen_during_processing += (counts.accepted + counts.modified + counts.filled +
+                                           counts.partially_filled + counts.canceled + counts.rejected > 0);
+    }
+
+    EngineConfig config;
+    config.keep_history = false;
+    MatchingEngine streaming_engine(config);
+    FillListener fills;
+    streaming_engine.processAllOrders(OrderView(orders), fills);
+
+    ResultCollector collector;
+    MatchingEngine collected_engine(config);
+    collected_engine.processAllOrders(OrderView(orders), collector);
+
+    // THEN : un événement par résultat, dès le premier ordre
+    EXPECT_EQ(results_seen_during_processing, 6);
+    EXPECT_EQ(counts.accepted, 2);
+    EXPECT_EQ(counts.modified, 1);
+    EXPECT_EQ(counts.filled, 1);
+    EXPECT_EQ(counts.partially_filled, 1);
+    EXPECT_EQ(counts.canceled, 1);
+    EXPECT_EQ(counts.rejected, 1);
+    EXPECT_EQ(engine.getResults().size(), 7u);
+
+    EXPECT_EQ(fills.fills, 2);
+    EXPECT_EQ(fills.others, 5);
+    EXPECT_TRUE(streaming_engine.getResults().empty());
+
+    EXPECT_EQ(collector.results.size(), engine.getResults().size());
+    for (size_t i = 0; i < collector.results.size(); i++) {
+        EXPECT_EQ(collector.results.orderId(i), engine.getResults().orderId(i));
+        EXPECT_EQ(collector.results.status(i), engine.getResults().status(i));
+    }
+    std::cout << "PASS : abonnés appelés pour chaque résultat\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie qu'une exception levée par un abonné pendant processOrders ne laisse pas l'engine écrire
+// dans la table de l'appelant : les ordres suivants reviennent dans l'historique
+// ###########################################################################################################
+
+// Abonné qui lève une exception au premier résultat
+struct ThrowingListener : public EngineListener {
+    void onResult(const OrderResult&) override { throw std::runtime_error("abonné en erreur"); }
+};
+
+void testProcessOrdersRestoresOutputOnException() {
+    std::cout << "Test de la sortie de processOrders sur exception d'un abonné" << std::endl;
+
+    // GIVEN : un engine avec un abonné qui lève une exception
+    MatchingEngine engine;
+    ThrowingListener listener;
+    engine.setListener(&listener);
+    std::vector<Order> orders = {{1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 15000, Action::NEW}};
+    ResultTable out;
+
+    // WHEN : l'exception traverse processOrders, puis un ordre est traité sans abonné
+    bool thrown = false;
+    try {
+        engine.processOrders(OrderView(orders), out);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    engine.setListener(nullptr);
+    size_t out_size = out.size();
+    engine.processOrder({2000, 2, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 10, 16000, Action::NEW});
+
+    // THEN : le résultat du second ordre est dans l'historique, la table de l'appelant n'a plus bougé
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(out.size(), out_size);
+    EXPECT_EQ(engine.getResults().size(), 1u);
+    EXPECT_EQ(engine.getResults().orderId(0), 2);
+    std::cout << "PASS : l'historique reste la sortie de l'engine\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie le meilleur prix (BBO), la profondeur L2 et les variations de niveaux émises pour chaque ordre
+// ###########################################################################################################
+
+// Abonné qui compte les mises à jour de profondeur
+struct DepthListener : public StaticListener<DepthListener> {
+    int updates = 0;
+    size_t levels = 0;
+    void onDepthUpdate(const std::vector<LevelDelta>& deltas) { updates++; levels += deltas.size(); }
+};
+
+void testTopOfBookAndDepth() {
+    std::cout << "Test du meilleur prix et de la profondeur" << std::endl;
+
+    // GIVEN : un carnet sur deux niveaux de chaque côté
+    EngineConfig config;
+    config.track_depth = true;
+    MatchingEngine engine(config);
+    std::vector<Order> orders = {
+        {1000, 1, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 30, 15000, Action::NEW},
+        {1001, 2, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 20, 15000, Action::NEW},
+        {1002, 3, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 14990, Action::NEW},
+        {1003, 4, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 15, 15010, Action::NEW},
+        {1004, 5, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 25, 15020, Action::NEW}
+    };
+    for (const Order& order : orders) {
+        engine.processOrder(order);
+    }
+
+    // THEN : BBO et profondeur conformes
+    TopOfBook top = engine.topOfBook();
+    EXPECT_TRUE(top.has_bid && top.has_ask);
+    EXPECT_EQ(top.bid.price, 15000);
+    EXPECT_EQ(top.bid.quantity, 50);
+    EXPECT_EQ(top.bid.order_count, 2u);
+    EXPECT_EQ(top.ask.price, 15010);
+    DepthLevel levels[5];
+    EXPECT_EQ(engine.depth(Side::BUY, 5, levels), 2u);
+    EXPECT_EQ(levels[1].price, 14990);
+    EXPECT_EQ(levels[1].quantity, 10);
+    EXPECT_EQ(engine.depth(Side::SELL, 1, levels), 1u);
+    EXPECT_EQ(levels[0].price, 15010);
+
+    // WHEN : une vente qui exécute tout l'ordre 1 et une partie de l'ordre 2
+    DepthListener listener;
+    engine.processOrder({2000, 6, Instrument("AAPL"), Side::SELL, OrderType::LIMIT, 40, 15000, Action::NEW}, listener);
+
+    // THEN : une seule variation, celle du niveau 15000 côté achat
+    const std::vector<LevelDelta>& deltas = engine.lastDepthChanges();
+    EXPECT_EQ(deltas.size(), 1u);
+    EXPECT_EQ(deltas[0].side, Side::BUY);
+    EXPECT_EQ(deltas[0].price, 15000);
+    EXPECT_EQ(deltas[0].quantity, 10);
+    EXPECT_EQ(deltas[0].order_count, 1u);
+    EXPECT_EQ(listener.updates, 1);
+
+    // WHEN : annulation du reliquat (le niveau disparaît), puis déplacement de l'ordre 3
+    engine.processOrder({3000, 2, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL}, listener);
+    EXPECT_EQ(engine.lastDepthChanges().size(), 1u);
+    EXPECT_EQ(engine.lastDepthChanges()[0].quantity, 0);
+    EXPECT_EQ(engine.lastDepthChanges()[0].order_count, 0u);
+    EXPECT_EQ(engine.topOfBook().bid.price, 14990);
+    engine.processOrder({4000, 3, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 10, 14980, Action::MODIFY}, listener);
+    EXPECT_EQ(engine.lastDepthChanges().size(), 2u);
+    EXPECT_EQ(engine.topOfBook().bid.price, 14980);
+
+    // Un rejet ne touche aucun niveau
+    engine.processOrder({5000, 99, Instrument("AAPL"), Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL}, listener);
+    EXPECT_TRUE(engine.lastDepthChanges().empty());
+    EXPECT_EQ(listener.updates, 3);
+    EXPECT_EQ(listener.levels, 4u);
+    std::cout << "PASS : meilleur prix, profondeur et variations conformes\n";
+}
+
+// ###########################################################################################################
+// Test qui vérifie, sur un flux aléatoire, qu'un carnet L2 reconstruit uniquement à partir des variations
+// est toujours identique à la profondeur de l'engine
+// ###########################################################################################################
+
+void testDepthDeltasRebuildBook() {
+    std::cout << "Test de reconstruction du carnet L2 à partir des variations" << std::endl;
+
+    // GIVEN : un flux aléatoire de NEW (qui croisent parfois), MODIFY et CANCEL
+    EngineConfig config;
+    config.track_depth = true;
+    MatchingEngine engine(config);
+    std::mt19937 rng(7);
+    std::vector<int> ids;
+    std::map<Price, std::pair<long long, uint32_t>, std::greater<Price>> bids;
+    std::map<Price, std::pair<long long, uint32_t>> asks;
+
+    for (int i = 0; i < 5000; i++) {
+        Order order{1000 + i, 0, Instrument("AAPL"), (rng() % 2) ? Side::BUY : Side::SELL, OrderType::LIMIT,
+                    1 + static_cast<int>(rng() % 50), 14950 + static_cast<Price>(rng() % 100), Action::NEW};
+        unsigned draw = rng() % 10;
+        if (draw < 2 && !ids.empty()) {
+            order.order_id = ids[rng() % ids.size()];
+            order.action = (draw == 0) ? Action::CANCEL : Action::MODIFY;
+        } else {
+            order.order_id = i + 1;
+            ids.push_back(order.order_id);
+            if (draw == 9) {
+                order.type = OrderType::MARKET;
+            }
+        }
+
+        // WHEN : on applique les variations de chaque ordre à la copie L2
+        engine.processOrder(order);
+        for (const LevelDelta& delta : engine.lastDepthChanges()) {
+            if (delta.side == Side::BUY && delta.order_count == 0) {
+                bids.erase(delta.price);
+            } else if (delta.side == Side::BUY) {
+                bids[delta.price] = {delta.quantity, delta.order_count};
+            } else if (delta.order_count == 0) {
+                asks.erase(delta.price);
+            } else {
+                asks[delta.price] = {delta.quantity, delta.order_count};
+            }
+        }
+    }
+
+    // THEN : copie identique à la profondeur complète de l'engine
+    std::vector<DepthLevel> levels(200);
+    size_t bid_count = engine.depth(Side::BUY, levels.size(), levels.data());
+    EXPECT_EQ(bid_count, bids.size());
+    size_t i = 0;
+    for (const auto& [price, level] : bids) {
+        EXPECT_EQ(levels[i].price, price);
+        EXPECT_EQ(levels[i].quantity, level.first);
+        EXPECT_EQ(levels[i].order_count, level.second);
+        i++;
+    }
+    size_t ask_count = engine.depth(Side::SELL, levels.size(), levels.data());
+    EXPECT_EQ(ask_count, asks.size());
+    i = 0;
+    for (const auto& [price, level] : asks) {
+        EXPECT_EQ(levels[i].price, price);
+        EXPECT_EQ(levels[i].quantity, level.first);
+        i++;
+    }
+    bool not_crossed = bids.empty() || asks.empty() || bids.begin()->first < asks.begin()->first;
+    EXPECT_TRUE(not_crossed);
+    std::cout << "PASS : carnet L2 reconstruit sur " << bid_count + ask_count << " niveaux\n";
+}
+
+// ###########################################################################################################
+// Test de l'histogramme des latences (utilisé par les mesures de performance) : valeurs exactes jusqu'à 255,
+// intervalles à partir de 256 (erreur relative < 1%, jamais au-dessus du maximum observé), et valeur maximale
+// d'un uint64_t
+// ###########################################################################################################
+
+void testLatencyHistogram() {
+    std::cout << "Test de l'histogramme des latences" << std::endl;
+
+    // GIVEN : histogramme vide
+    LatencyHistogram histogram;
+
+    // THEN : aucune valeur
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.percentile(50.0), 0u);
+    EXPECT_EQ(histogram.min(), 0u);
+
+    // WHEN : 255 (dernière valeur exacte), puis 256 et 257 (même intervalle, le premier au-delà des valeurs exactes)
+    histogram.record(255);
+    histogram.record(256);
+    histogram.record(257);
+
+    // THEN : 255 est exact, 256 et 257 sont rendus par la borne haute de leur intervalle (257)
+    EXPECT_EQ(histogram.count(), 3u);
+    EXPECT_EQ(histogram.percentile(0.0), 255u);
+    EXPECT_EQ(histogram.percentile(33.3), 255u);
+    EXPECT_EQ(histogram.percentile(33.4), 257u);
+    EXPECT_EQ(histogram.percentile(100.0), 257u);
+    EXPECT_EQ(histogram.percentile(150.0), 257u);
+    EXPECT_EQ(histogram.min(), 255u);
+    EXPECT_EQ(histogram.max(), 257u);
+
+    // WHEN : 256 seul
+    LatencyHistogram single;
+    single.record(256);
+
+    // THEN : borne de l'intervalle ramenée au maximum observé
+    EXPECT_EQ(single.percentile(50.0), 256u);
+
+    // WHEN : grandes valeurs, jusqu'à la valeur maximale d'un uint64_t
+    LatencyHistogram large;
+    const uint64_t one_second = 1000000000;
+    large.record(one_second);
+    large.record(UINT64_MAX);
+
+    // THEN : erreur relative < 1%, et le dernier intervalle contient UINT64_MAX
+    uint64_t median = large.percentile(50.0);
+    EXPECT_TRUE(median >= one_second && median - one_second < one_second / 100);
+    EXPECT_EQ(large.percentile(100.0), UINT64_MAX);
+    EXPECT_EQ(large.max(), UINT64_MAX);
+
+    // WHEN : fusion dans l'histogramme des petites valeurs
+    histogram.merge(large);
+
+    // THEN : comptes et extrêmes des deux histogrammes
+    EXPECT_EQ(histogram.count(), 5u);
+    EXPECT_EQ(histogram.min(), 255u);
+    EXPECT_EQ(histogram.percentile(60.0), 257u);
+    EXPECT_EQ(histogram.percentile(100.0), UINT64_MAX);
+    std::cout << "PASS : percentiles exacts jusqu'à 255, bornés au-delà\n";
+}
+
 // ###########################################################################################################
 // MAIN
 // ###########################################################################################################
@@ -261,6 +1000,19 @@ int main() {
     testExecuteMarketIfCounterparty();
     testRejectIfBadInput();
     testMultipleCases();
+    testCanceledOrModifiedOrderNeverMatches();
+    testOrderIndexConsistency();
+    testSuccessiveModifyUseInitialQuantity();
+    testMatchBuffersResetBetweenOrders();
+    testUnsortedViewIsProcessedChronologically();
+    testNoAllocationInSteadyState();
+    testNoAllocationPerOrderByFlow();
+    testResultTableChunks();
+    testListenerEvents();
+    testProcessOrdersRestoresOutputOnException();
+    testTopOfBookAndDepth();
+    testDepthDeltasRebuildBook();
+    testLatencyHistogram();
 
     std::cout << "TOUS LES TESTS ONT ETE PASSES AVEC SUCCES !" << std::endl;
     return 0;
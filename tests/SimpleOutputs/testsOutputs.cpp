@@ -3,8 +3,18 @@
 #include "core/MatchingEngine.h"
 #include "data/CSVReader.h"
 #include "data/CSVWriter.h"
+#include "data/ResultLog.h"
+#include "core/Pipeline.h"
+#include "core/ShardedEngine.h"
+#include "utils/ThreadPool.h"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <iostream>
 #include <fstream>
+#include <map>
+#include <thread>
+#include <atomic>
 #include <vector>
 #include <cassert>
 
@@ -114,6 +124,271 @@ void testConcordanceWithExpectedOutput(const std::string& input_file, const std:
     std::cout << "PASS : " << test_name << " - Concordance parfaite\n";
 }
 
+// ###########################################################################################################
+// Test qui vérifie que le traitement des actifs en parallèle (pool de threads) produit exactement
+// les mêmes fichiers qu'un traitement séquentiel, actif par actif
+// ###########################################################################################################
+
+void testParallelMatchesSequential(const std::string& input_file, size_t thread_count) {
+    std::cout << "Test parallèle / séquentiel : " << input_file << " (" << thread_count << " threads)" << std::endl;
+
+    // GIVEN : les ordres de chaque actif
+    CsvReader reader(input_file);
+    reader.init();
+    std::map<std::string, OrderView> assets = reader.getMapOrder();
+    EXPECT_TRUE(assets.size() > 1);
+    system("mkdir -p build/tests/SimpleOutputs/parallel");
+    std::string prefix = "build/tests/SimpleOutputs/parallel/";
+
+    // WHEN : traitement séquentiel puis parallèle de chaque actif
+    for (const auto& [asset_name, asset_orders] : assets) {
+        MatchingEngine engine;
+        engine.processAllOrders(asset_orders);
+        CsvWriter writer(prefix + "seq_" + asset_name + ".csv");
+        writer.WriteToCsv(engine.getResults());
+    }
+    {
+        ThreadPool pool(thread_count);
+        for (const auto& [asset_name, asset_orders] : assets) {
+            pool.submit([&prefix, &asset_name = asset_name, &asset_orders = asset_orders]() {
+                MatchingEngine engine;
+                engine.processAllOrders(asset_orders);
+                CsvWriter writer(prefix + "par_" + asset_name + ".csv");
+                writer.WriteToCsv(engine.getResults());
+            });
+        }
+        pool.wait();
+    }
+
+    // THEN : fichiers identiques
+    for (const auto& asset : assets) {
+        EXPECT_TRUE(compareCSVFiles(prefix + "seq_" + asset.first + ".csv", prefix + "par_" + asset.first + ".csv"));
+    }
+    std::cout << "PASS : traitement parallèle identique au séquentiel\n";
+}
+
+// ###########################################################################################################
+// Mode continu réparti sur des shards : mêmes résultats, actif par actif, que le traitement par lot
+// ###########################################################################################################
+
+void testShardedMatchesBatch(const std::string& input_file, size_t shard_count) {
+    std::cout << "Test shards / lot : " << input_file << " (" << shard_count << " shards)" << std::endl;
+
+    // GIVEN : un flux d'ordres chronologique sur plusieurs actifs, et des files volontairement petites
+    // (le routeur et les shards doivent attendre régulièrement)
+    CsvReader reader(input_file);
+    reader.init();
+    std::map<std::string, OrderView> assets = reader.getMapOrder();
+    EXPECT_TRUE(assets.size() > 1);
+    system("mkdir -p build/tests/SimpleOutputs/parallel");
+    std::string prefix = "build/tests/SimpleOutputs/parallel/";
+
+    // WHEN : envoi des ordres un par un aux shards, résultats récupérés au fil de l'eau par un thread collecteur
+    // (les shards attendent le collecteur quand leur file de sortie est pleine), puis après l'arrêt
+    std::vector<OrderResult> results;
+    {
+        ShardedEngine sharded(shard_count, 64, false);
+        std::atomic<bool> done(false);
+        std::thread collector([&sharded, &done, &results]() {
+            while (!done.load(std::memory_order_acquire)) {
+                sharded.pollResults(results);
+                std::this_thread::yield();
+            }
+        });
+        for (const Order& order : reader.getOrders()) {
+            sharded.submit(order);
+        }
+        sharded.stop();
+        done.store(true, std::memory_order_release);
+        collector.join();
+        sharded.pollResults(results);
+    }
+
+    // THEN : pour chaque actif, les résultats des shards sont ceux du traitement par lot
+    std::map<std::string, std::vector<OrderResult>> sharded_results;
+    for (const OrderResult& result : results) {
+        sharded_results[result.original_order.instrument.name()].push_back(result);
+    }
+    for (const auto& [asset_name, asset_orders] : assets) {
+        MatchingEngine engine;
+        engine.processAllOrders(asset_orders);
+        CsvWriter batch_writer(prefix + "batch_" + asset_name + ".csv");
+        batch_writer.WriteToCsv(engine.getResults());
+        CsvWriter shard_writer(prefix + "shard_" + asset_name + ".csv");
+        shard_writer.WriteToCsv(sharded_results[asset_name]);
+        EXPECT_TRUE(compareCSVFiles(prefix + "batch_" + asset_name + ".csv", prefix + "shard_" + asset_name + ".csv"));
+    }
+    std::cout << "PASS : traitement par shards identique au traitement par lot\n";
+}
+
+// ###########################################################################################################
+// Traitement en pipeline (lecture -> matching -> formatage -> écriture) : mêmes fichiers que le traitement par lot
+// ###########################################################################################################
+
+void testPipelineMatchesBatch(const std::string& input_file) {
+    std::cout << "Test pipeline / lot : " << input_file << std::endl;
+
+    // GIVEN : un fichier chronologique sur plusieurs actifs
+    CsvReader reader(input_file);
+    reader.init();
+    std::map<std::string, OrderView> assets = reader.getMapOrder();
+    EXPECT_TRUE(assets.size() > 1);
+    system("mkdir -p build/tests/SimpleOutputs/parallel");
+    std::string prefix = "build/tests/SimpleOutputs/parallel/";
+
+    // WHEN : traitement en pipeline avec de petits lots et des files courtes (les étages attendent souvent)
+    Pipeline pipeline(input_file, prefix + "pipe_", 100, 2);
+    const PipelineStats& stats = pipeline.run();
+    EXPECT_EQ(stats.orders, reader.getOrders().size());
+
+    // THEN : pour chaque actif, fichier identique au traitement par lot
+    size_t batch_results = 0;
+    for (const auto& [asset_name, asset_orders] : assets) {
+        MatchingEngine engine;
+        engine.processAllOrders(asset_orders);
+        batch_results += engine.getResults().size();
+        CsvWriter writer(prefix + "batch_" + asset_name + ".csv");
+        writer.WriteToCsv(engine.getResults());
+        EXPECT_TRUE(compareCSVFiles(prefix + "batch_" + asset_name + ".csv", prefix + "pipe_" + asset_name + ".csv"));
+    }
+    EXPECT_EQ(stats.results, batch_results);
+    EXPECT_EQ(stats.failed_files, 0u);
+
+    // Les fichiers de sortie qui ne peuvent pas être ouverts sont signalés
+    Pipeline unwritable(input_file, prefix + "missing_dir/pipe_", 100, 2);
+    size_t failed_files = unwritable.run().failed_files;
+    EXPECT_EQ(failed_files, assets.size());
+    std::cout << "PASS : traitement en pipeline identique au traitement par lot\n";
+}
+
+// ###########################################################################################################
+// Formatage d'une ligne de sortie : prix décimaux exacts selon le tick, sans zéros inutiles
+// ###########################################################################################################
+
+void testRowFormatting() {
+    std::cout << "Test de formatage des lignes de sortie" << std::endl;
+
+    // GIVEN : des instruments avec des ticks différents
+    TickTable::set("FMT_CENT", {2, 1});
+    TickTable::set("FMT_FOUR", {4, 1});
+    TickTable::set("FMT_UNIT", {0, 1});
+    TickTable::set("FMT_FIVE", {2, 5});
+    CsvWriter writer;
+    auto row = [&writer](const std::string& instrument, Price price, Price execution_price) {
+        Order order{1617278400000000000LL, 42, Instrument(instrument), Side::BUY, OrderType::LIMIT, 10, price, Action::NEW};
+        OrderResult result(order);
+        result.status = OrderStatus::PARTIALLY_EXECUTED;
+        result.executed_quantity = 4;
+        result.execution_price = execution_price;
+        result.counterparty_id = 7;
+        return writer.OrderToString(result);
+    };
+
+    // WHEN / THEN : mêmes libellés et mêmes prix que l'ancien formatage
+    EXPECT_EQ(row("FMT_CENT", 15030, 15000),
+              "1617278400000000000,42,FMT_CENT,BUY,LIMIT,10,150.3,NEW,PARTIALLY_EXECUTED,4,150,7");
+    EXPECT_EQ(row("FMT_CENT", 5, 0), "1617278400000000000,42,FMT_CENT,BUY,LIMIT,10,0.05,NEW,PARTIALLY_EXECUTED,4,0,7");
+    EXPECT_EQ(row("FMT_FOUR", 11050, 10001), "1617278400000000000,42,FMT_FOUR,BUY,LIMIT,10,1.105,NEW,PARTIALLY_EXECUTED,4,1.0001,7");
+    EXPECT_EQ(row("FMT_UNIT", 120, 100), "1617278400000000000,42,FMT_UNIT,BUY,LIMIT,10,120,NEW,PARTIALLY_EXECUTED,4,100,7");
+    EXPECT_EQ(row("FMT_FIVE", 3003, 20), "1617278400000000000,42,FMT_FIVE,BUY,LIMIT,10,150.15,NEW,PARTIALLY_EXECUTED,4,1,7");
+    std::cout << "PASS : formatage des lignes de sortie\n";
+}
+
+// ###########################################################################################################
+// Écriture au fil de l'eau : un engine sans historique, abonné à un CsvStreamWriter, produit le même fichier
+// que l'écriture de l'historique complet
+// ###########################################################################################################
+
+void testStreamingWriterMatchesExpected(const std::string& input_file, const std::string& expected_output_file) {
+    std::cout << "Test écriture au fil de l'eau : " << input_file << std::endl;
+
+    // GIVEN : un engine qui ne garde aucun résultat
+    CsvReader reader(input_file);
+    reader.init();
+    EngineConfig config;
+    config.keep_history = false;
+    MatchingEngine engine(config);
+    system("mkdir -p build/tests/SimpleOutputs/parallel");
+    std::string csv_file = "build/tests/SimpleOutputs/parallel/streamed.csv";
+
+    // WHEN : chaque résultat est écrit dès qu'il est produit
+    {
+        CsvStreamWriter writer(csv_file);
+        EXPECT_TRUE(writer.isOpen());
+        engine.setListener(&writer);
+        engine.processAllOrders(reader.getOrders());
+        engine.setListener(nullptr);
+    }
+
+    // THEN : historique vide, fichier identique à l'output attendu
+    EXPECT_TRUE(engine.getResults().empty());
+    EXPECT_TRUE(compareCSVFiles(expected_output_file, csv_file));
+    std::cout << "PASS : écriture au fil de l'eau conforme\n";
+}
+
+// ###########################################################################################################
+// Journal binaire : rendu en CSV identique à l'output attendu (libellés bruts des lignes invalides compris)
+// ###########################################################################################################
+
+void testResultLogRoundTrip(const std::string& input_file, const std::string& expected_output_file) {
+    std::cout << "Test journal binaire : " << input_file << std::endl;
+
+    // GIVEN : les résultats du matching engine
+    CsvReader reader(input_file);
+    reader.init();
+    MatchingEngine engine;
+    ResultView results = engine.processAllOrders(reader.getOrders());
+    system("mkdir -p tests/SimpleOutputs/GeneratedOutputs");
+    std::string log_file = "tests/SimpleOutputs/GeneratedOutputs/result_log.bin";
+    std::string csv_file = "tests/SimpleOutputs/GeneratedOutputs/result_log.csv";
+
+    // WHEN : écriture du journal binaire, relecture puis rendu en CSV
+    ResultLogWriter writer(log_file);
+    EXPECT_TRUE(writer.WriteToBinary(results));
+    ResultLogReader log(log_file);
+    EXPECT_TRUE(log.isValid());
+    EXPECT_EQ(log.size(), results.size());
+    EXPECT_TRUE(log.writeCsv(csv_file));
+
+    // THEN : enregistrements conformes et CSV identique à l'output attendu
+    EXPECT_EQ(log.symbol(log.record(0).instrument_id), results[0].original_order.instrument.name());
+    EXPECT_EQ(log.record(0).price, results[0].original_order.price);
+    EXPECT_TRUE(compareCSVFiles(expected_output_file, csv_file));
+
+    // Un fichier qui n'est pas un journal est refusé, de même qu'un journal dont un enregistrement
+    // désigne un instrument absent de sa table des symboles
+    ResultLogReader not_a_log(input_file);
+    EXPECT_TRUE(!not_a_log.isValid());
+    // (ou un code de côté / statut sans valeur connue ni libellé brut dans le journal)
+    std::string corrupted_file = "tests/SimpleOutputs/GeneratedOutputs/result_log_corrupted.bin";
+    std::string log_bytes;
+    {
+        std::ifstream input(log_file, std::ios::binary);
+        log_bytes.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    }
+    ResultLogHeader log_header;
+    std::memcpy(&log_header, log_bytes.data(), sizeof(log_header));
+    auto corruptFirstRecord = [&](size_t field_offset, const void* value, size_t size) {
+        std::string bytes = log_bytes;
+        std::memcpy(&bytes[log_header.records_offset + field_offset], value, size);
+        std::ofstream output(corrupted_file, std::ios::binary);
+        output.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+    uint32_t bad_id = log_header.symbol_count;
+    corruptFirstRecord(offsetof(ResultRecord, instrument_id), &bad_id, sizeof(bad_id));
+    EXPECT_TRUE(!ResultLogReader(corrupted_file).isValid());
+    uint8_t bad_side = 5;
+    corruptFirstRecord(offsetof(ResultRecord, side), &bad_side, sizeof(bad_side));
+    EXPECT_TRUE(!ResultLogReader(corrupted_file).isValid());
+    uint8_t bad_status = 200;
+    corruptFirstRecord(offsetof(ResultRecord, status), &bad_status, sizeof(bad_status));
+    EXPECT_TRUE(!ResultLogReader(corrupted_file).isValid());
+
+    // Un journal qui ne peut pas être écrit est signalé
+    ResultLogWriter unwritable("tests/SimpleOutputs/GeneratedOutputs/missing_dir/result_log.bin");
+    EXPECT_TRUE(!unwritable.WriteToBinary(results));
+    std::cout << "PASS : journal binaire relu à l'identique\n";
+}
 
 // =============================================================================
 // MAIN AVEC SUPPORT D'ARGUMENTS
@@ -137,6 +412,30 @@ int main(int argc, char* argv[]) {
             "Input avec erreurs"
             );
 
+    std::cout << "Test 3 : formatage des lignes" << std::endl;
+    testRowFormatting();
+
+    std::cout << "Test 4 : journal binaire" << std::endl;
+    testResultLogRoundTrip(
+            "tests/SimpleOutputs/Inputs/Test2.csv",
+            "tests/SimpleOutputs/ExpectedOutputs/Test2_ExpectedOutput.csv"
+            );
+
+    std::cout << "Test 5 : actifs traités en parallèle" << std::endl;
+    testParallelMatchesSequential("tests/performance/inputs/10000_orders.csv", 4);
+
+    std::cout << "Test 6 : flux continu réparti sur des shards" << std::endl;
+    testShardedMatchesBatch("tests/performance/inputs/10000_orders.csv", 3);
+
+    std::cout << "Test 7 : traitement en pipeline" << std::endl;
+    testPipelineMatchesBatch("tests/performance/inputs/10000_orders.csv");
+
+    std::cout << "Test 8 : écriture au fil de l'eau" << std::endl;
+    testStreamingWriterMatchesExpected(
+            "tests/SimpleOutputs/Inputs/Test2.csv",
+            "tests/SimpleOutputs/ExpectedOutputs/Test2_ExpectedOutput.csv"
+            );
+
     std::cout << "\nTOUS LES TESTS ONT ETE PASSES AVEC SUCCES !" << std::endl;
     return 0;
 }
\ No newline at end of file
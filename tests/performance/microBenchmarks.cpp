@@ -0,0 +1,401 @@
+// MICRO-BENCHMARKS DES OPÉRATIONS ÉLÉMENTAIRES DU MATCHING ENGINE
+// Chaque opération (ajout au carnet, matching, CANCEL, MODIFY, rejet d'un doublon, parsing d'une ligne) est mesurée
+// isolément, sur des carnets pré-remplis de 10, 1 000 et 100 000 ordres au repos.
+// Chaque appel est chronométré individuellement (compteur de cycles rdtsc, sinon horloge monotone), puis l'état
+// du carnet est restauré hors mesure : toutes les répétitions mesurent donc la même situation.
+// Résultats : cycles/op et ns/op (médiane des répétitions), avec min / max / écart-type entre répétitions.
+// (à lancer en build de production : make RELEASE=1 bench_micro)
+#include "core/MatchingEngine.h"
+#include "data/CSVReader.h"
+#include "data/OrderFlowGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+// Paramètres de mesure : opérations par répétition, répétitions, opérations de chauffe (non mesurées)
+constexpr size_t OPS_PER_ROUND = 1000;
+constexpr size_t ROUND_COUNT = 25;
+constexpr size_t WARMUP_OPS = 2000;
+
+// Carnet pré-rempli : prix autour de BOOK_MID, les 3 meilleurs niveaux de chaque côté ne contiennent qu'un ordre
+// (pour le balayage de plusieurs niveaux), les autres ordres sont répartis sur DEEP_LEVELS niveaux plus loin
+constexpr Price BOOK_MID = 100000;
+constexpr int THIN_LEVELS = 3;
+constexpr int DEEP_LEVELS = 1000;
+constexpr int RESTING_QUANTITY = 1000000;
+
+// Résultat d'un micro-benchmark
+struct MicroResult {
+    double cycles_per_op;       // médiane des répétitions
+    double ns_median;
+    double ns_min;
+    double ns_max;
+    double ns_stddev;
+};
+
+// ################################################################################################
+// Chronométrage
+// ################################################################################################
+
+// Lecture du compteur (cycles si rdtsc est disponible, nanosecondes sinon).
+// Les barrières lfence empêchent le processeur d'exécuter l'opération mesurée en dehors de la fenêtre.
+inline uint64_t readCounter() {
+#if BENCH_HAS_TSC
+    _mm_lfence();
+    uint64_t value = __rdtsc();
+    _mm_lfence();
+    return value;
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Nombre de valeurs du compteur par nanoseconde (étalonné sur 50 ms contre l'horloge monotone)
+double counterPerNanosecond() {
+#if BENCH_HAS_TSC
+    auto start_time = std::chrono::steady_clock::now();
+    uint64_t start = readCounter();
+    while (std::chrono::steady_clock::now() - start_time < std::chrono::milliseconds(50)) {}
+    uint64_t end = readCounter();
+    double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();
+    return static_cast<double>(end - start) / elapsed_ns;
+#else
+    return 1.0;
+#endif
+}
+
+// Coût d'une mesure à vide (retiré de chaque mesure)
+uint64_t measureOverhead() {
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < 10000; i++) {
+        uint64_t start = readCounter();
+        uint64_t end = readCounter();
+        overhead = std::min(overhead, end - start);
+    }
+    return overhead;
+}
+
+const double COUNTER_PER_NS = counterPerNanosecond();
+const uint64_t COUNTER_OVERHEAD = measureOverhead();
+
+// Mesure de operation(i) (seul appel chronométré), suivie de restore(i) hors mesure
+template <typename Operation, typename Restore>
+MicroResult measure(Operation&& operation, Restore&& restore) {
+    for (size_t i = 0; i < WARMUP_OPS; i++) {
+        operation(i % OPS_PER_ROUND);
+        restore(i % OPS_PER_ROUND);
+    }
+
+    std::vector<double> rounds;
+    for (size_t round = 0; round < ROUND_COUNT; round++) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            uint64_t start = readCounter();
+            operation(i);
+            uint64_t end = readCounter();
+            total += (end - start > COUNTER_OVERHEAD) ? end - start - COUNTER_OVERHEAD : 0;
+            restore(i);
+        }
+        rounds.push_back(static_cast<double>(total) / OPS_PER_ROUND);
+    }
+
+    std::sort(rounds.begin(), rounds.end());
+    double median = rounds[rounds.size() / 2];
+    double mean = 0.0;
+    for (double value : rounds) {
+        mean += value;
+    }
+    mean /= rounds.size();
+    double variance = 0.0;
+    for (double value : rounds) {
+        variance += (value - mean) * (value - mean);
+    }
+    variance /= rounds.size();
+
+    return MicroResult{median, median / COUNTER_PER_NS, rounds.front() / COUNTER_PER_NS,
+                       rounds.back() / COUNTER_PER_NS, std::sqrt(variance) / COUNTER_PER_NS};
+}
+
+void displayResult(const std::string& operation, const std::string& depth, const MicroResult& result) {
+    std::cout << std::left << std::fixed << std::setprecision(1)
+              << std::setw(28) << operation
+              << std::setw(12) << depth;
+    if (BENCH_HAS_TSC) {
+        std::cout << std::setw(12) << result.cycles_per_op;
+    } else {
+        std::cout << std::setw(12) << "-";
+    }
+    std::cout << std::setw(12) << result.ns_median
+              << std::setw(12) << result.ns_min
+              << std::setw(12) << result.ns_max
+              << std::setw(12) << result.ns_stddev
+              << std::endl;
+}
+
+// ################################################################################################
+// Carnet pré-rempli
+// ################################################################################################
+
+// Ordres au repos d'un carnet de depth ordres (moitié à l'achat, moitié à la vente), IDs 1..depth
+std::vector<Order> restingOrders(size_t depth) {
+    std::vector<Order> orders;
+    size_t per_side = std::max<size_t>(1, depth / 2);
+    for (size_t k = 0; k < 2 * per_side; k++) {
+        Side side = (k % 2 == 0) ? Side::SELL : Side::BUY;
+        size_t rank = k / 2;
+        Price level = (rank < THIN_LEVELS) ? static_cast<Price>(rank + 1)
+                                           : static_cast<Price>(THIN_LEVELS + 1 + (rank - THIN_LEVELS) % DEEP_LEVELS);
+        Price price = (side == Side::SELL) ? BOOK_MID + level : BOOK_MID - level;
+        orders.push_back(Order{static_cast<long long>(k), static_cast<int>(k + 1), Instrument("AAPL"), side, OrderType::LIMIT,
+                               RESTING_QUANTITY, price, Action::NEW});
+    }
+    return orders;
+}
+
+// Ordre passif (ne croise pas le carnet) sur un niveau profond choisi au hasard
+Order passiveOrder(std::mt19937_64& rng, int order_id, Action action) {
+    Side side = (rng() & 1) ? Side::BUY : Side::SELL;
+    Price level = THIN_LEVELS + 1 + static_cast<Price>(rng() % DEEP_LEVELS);
+    Price price = (side == Side::SELL) ? BOOK_MID + level : BOOK_MID - level;
+    return Order{0, order_id, Instrument("AAPL"), side, OrderType::LIMIT, 100, price, action};
+}
+
+// ################################################################################################
+// Opérations du matching engine
+// ################################################################################################
+
+void benchmarkEngine(size_t depth) {
+    std::vector<Order> resting = restingOrders(depth);
+    int next_id = static_cast<int>(resting.size()) + 1;
+    std::string depth_label = std::to_string(resting.size());
+    std::mt19937_64 rng(depth);
+    std::vector<OrderResult> drained;
+
+    // Engine neuf pour chaque opération, chargé avec le carnet de départ
+    auto freshEngine = [&resting]() {
+        std::unique_ptr<MatchingEngine> engine(new MatchingEngine());
+        for (const Order& order : resting) {
+            engine->addToBook(order);
+        }
+        return engine;
+    };
+    auto randomResting = [&]() -> const Order& { return resting[rng() % resting.size()]; };
+
+    // addToBook : ajout d'un ordre passif, retiré ensuite
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            inputs.push_back(passiveOrder(rng, next_id++, Action::NEW));
+        }
+        displayResult("addToBook", depth_label, measure(
+            [&](size_t i) { engine->addToBook(inputs[i]); },
+            [&](size_t i) { engine->removeFromBook(inputs[i].order_id); }));
+    }
+
+    // tryMatch sans croisement : le prix ne touche pas le meilleur prix opposé
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            inputs.push_back(passiveOrder(rng, next_id++, Action::NEW));
+        }
+        displayResult("tryMatch (sans croisement)", depth_label, measure(
+            [&](size_t i) { engine->tryMatch(inputs[i]); },
+            [](size_t) {}));
+    }
+
+    // tryMatch avec une seule exécution partielle de l'ordre en tête du carnet (sa quantité suffit à toutes les mesures)
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            Side side = (i % 2 == 0) ? Side::BUY : Side::SELL;
+            Price price = (side == Side::BUY) ? BOOK_MID + 1 : BOOK_MID - 1;
+            inputs.push_back(Order{0, next_id++, Instrument("AAPL"), side, OrderType::LIMIT, 1, price, Action::NEW});
+        }
+        displayResult("tryMatch (1 trade)", depth_label, measure(
+            [&](size_t i) { engine->tryMatch(inputs[i]); },
+            [](size_t) {}));
+    }
+
+    // tryMatch qui balaye les 3 meilleurs niveaux opposés (les ordres exécutés sont remis dans le carnet)
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            Side side = (i % 2 == 0) ? Side::BUY : Side::SELL;
+            Price price = (side == Side::BUY) ? BOOK_MID + THIN_LEVELS : BOOK_MID - THIN_LEVELS;
+            inputs.push_back(Order{0, next_id++, Instrument("AAPL"), side, OrderType::LIMIT, THIN_LEVELS * RESTING_QUANTITY,
+                                   price, Action::NEW});
+        }
+        // Ordres des niveaux balayés (les premiers ordres de chaque côté, voir restingOrders)
+        std::vector<Order> swept_sells, swept_buys;
+        for (const Order& order : resting) {
+            Price level = (order.side == Side::SELL) ? order.price - BOOK_MID : BOOK_MID - order.price;
+            if (level <= THIN_LEVELS) {
+                (order.side == Side::SELL ? swept_sells : swept_buys).push_back(order);
+            }
+        }
+        displayResult("tryMatch (3 niveaux)", depth_label, measure(
+            [&](size_t i) { engine->tryMatch(inputs[i]); },
+            [&](size_t i) {
+                for (const Order& order : (inputs[i].side == Side::BUY) ? swept_sells : swept_buys) {
+                    engine->addToBook(order);
+                }
+            }));
+    }
+
+    // handleCancel d'un ordre au repos, remis ensuite dans le carnet
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            Order cancel = randomResting();
+            cancel.action = Action::CANCEL;
+            inputs.push_back(cancel);
+        }
+        displayResult("handleCancel", depth_label, measure(
+            [&](size_t i) { engine->handleCancel(inputs[i]); },
+            [&](size_t i) {
+                Order original = inputs[i];
+                original.action = Action::NEW;
+                engine->addToBook(original);
+                engine->drainResults(drained);
+                drained.clear();
+            }));
+    }
+
+    // handleModify : changement de niveau de prix (passif), même quantité
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            const Order& target = randomResting();
+            Price level = THIN_LEVELS + 1 + static_cast<Price>(rng() % DEEP_LEVELS);
+            Price price = (target.side == Side::SELL) ? BOOK_MID + level : BOOK_MID - level;
+            inputs.push_back(Order{0, target.order_id, Instrument("AAPL"), target.side, OrderType::LIMIT, RESTING_QUANTITY,
+                                   price, Action::MODIFY});
+        }
+        displayResult("handleModify", depth_label, measure(
+            [&](size_t i) { engine->handleModify(inputs[i]); },
+            [&](size_t) {
+                engine->drainResults(drained);
+                drained.clear();
+            }));
+    }
+
+    // handleNew d'un ordre passif : chemin rapide (ne croise pas le meilleur prix opposé, tryMatch n'est pas appelé)
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            inputs.push_back(passiveOrder(rng, next_id++, Action::NEW));
+        }
+        displayResult("handleNew (passif)", depth_label, measure(
+            [&](size_t i) { engine->handleNew(inputs[i]); },
+            [&](size_t i) {
+                engine->removeFromBook(inputs[i].order_id);
+                engine->drainResults(drained);
+                drained.clear();
+            }));
+    }
+
+    // Profondeur L2 : les 10 meilleurs niveaux d'un côté
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        DepthLevel levels[10];
+        displayResult("depth (10 niveaux)", depth_label, measure(
+            [&](size_t i) { engine->depth((i % 2 == 0) ? Side::BUY : Side::SELL, 10, levels); },
+            [](size_t) {}));
+    }
+
+    // handleNew d'un ID déjà présent dans le carnet : rejet
+    {
+        std::unique_ptr<MatchingEngine> engine = freshEngine();
+        std::vector<Order> inputs;
+        for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+            Order duplicate = passiveOrder(rng, 0, Action::NEW);
+            duplicate.order_id = randomResting().order_id;
+            inputs.push_back(duplicate);
+        }
+        displayResult("handleNew (ID en double)", depth_label, measure(
+            [&](size_t i) { engine->handleNew(inputs[i]); },
+            [&](size_t) {
+                engine->drainResults(drained);
+                drained.clear();
+            }));
+    }
+}
+
+// ################################################################################################
+// Parsing d'une ligne
+// ################################################################################################
+
+void benchmarkTestOrder() {
+    // Lignes d'un flux synthétique, découpées en champs à l'avance (seule la validation est mesurée)
+    OrderFlowGenerator generator{OrderFlowConfig()};
+    std::vector<std::string> lines(OPS_PER_ROUND);
+    std::vector<CsvRow> rows(OPS_PER_ROUND);
+    for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+        OrderFlowGenerator::appendCsvRow(generator.next(), lines[i]);
+    }
+    for (size_t i = 0; i < OPS_PER_ROUND; i++) {
+        std::string_view line = lines[i];
+        for (size_t field = 0; field < CSV_FIELD_COUNT; field++) {
+            size_t comma = line.find(',');
+            rows[i][field] = line.substr(0, comma);
+            line = (comma == std::string_view::npos) ? std::string_view() : line.substr(comma + 1);
+        }
+    }
+
+    CsvReader reader;
+    long long checksum = 0;
+    displayResult("CsvReader::testOrder", "-", measure(
+        [&](size_t i) { checksum += reader.testOrder(rows[i]).quantity; },
+        [](size_t) {}));
+    if (checksum == 0) {
+        std::cout << "(aucun ordre valide)" << std::endl;
+    }
+}
+
+int main() {
+    std::cout << "MATCHING ENGINE - MICRO-BENCHMARKS\n" << std::endl;
+    std::cout << OPS_PER_ROUND << " opérations par répétition, " << ROUND_COUNT << " répétitions, "
+              << WARMUP_OPS << " opérations de chauffe";
+    if (BENCH_HAS_TSC) {
+        std::cout << " - compteur rdtsc à " << std::fixed << std::setprecision(2) << COUNTER_PER_NS << " GHz";
+    }
+    std::cout << "\n" << std::endl;
+
+    std::cout << std::left
+              << std::setw(29) << "Opération"
+              << std::setw(12) << "Profondeur"
+              << std::setw(12) << "Cycles/op"
+              << std::setw(12) << "ns/op"
+              << std::setw(12) << "min(ns)"
+              << std::setw(12) << "max(ns)"
+              << std::setw(12) << "écart-type"
+              << std::endl;
+    std::cout << std::string(100, '-') << std::endl;
+
+    for (size_t depth : {10, 1000, 100000}) {
+        benchmarkEngine(depth);
+        std::cout << std::endl;
+    }
+    benchmarkTestOrder();
+    return 0;
+}
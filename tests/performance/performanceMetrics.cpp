@@ -1,37 +1,56 @@
 // FICHIER D'EVALUATION DES PERFORMANCES
-// On évalue, pour chaque fichier, le temps d'exécution de tous les ordres, 
-// le nombre d'ordres par seconde, la latence et la mémoire utilisée. 
+// On évalue, pour chaque fichier, le temps de chaque étape (lecture, matching, écriture), le nombre d'ordres
+// par seconde, la distribution des latences par ordre (percentiles, pas seulement la moyenne) et le pic de mémoire
+// du processus.
+// (à lancer de préférence en build de production : make RELEASE=1 test_performance)
 #include "core/MatchingEngine.h"
+#include "core/Pipeline.h"
+#include "core/ShardedEngine.h"
 #include "data/CSVReader.h"
+#include "data/CSVWriter.h"
+#include "data/OrderColumns.h"
+#include "utils/LatencyHistogram.h"
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <fstream>
+#include <cstdio>
 #include <sys/resource.h>
 
+// Catégories de latence : par action, puis selon que l'ordre a croisé le carnet (au moins un trade) ou non
+enum LatencyCategory { LATENCY_ALL, LATENCY_NEW, LATENCY_MODIFY, LATENCY_CANCEL, LATENCY_CROSSED, LATENCY_RESTING, LATENCY_CATEGORY_COUNT };
+const char* const LATENCY_CATEGORY_NAMES[LATENCY_CATEGORY_COUNT] = {"Tous", "NEW", "MODIFY", "CANCEL", "Croisés", "Non croisés"};
+
 // Structure contenant les résultats (les performances)
 struct BenchmarkResult {
     std::string filename;
     size_t num_orders;
-    double execution_time_ms;
-    double orders_per_second;
-    double avg_latency_us;
-    size_t peak_memory_kb;
+    double parse_time_ms;
+    double match_time_ms;
+    double write_time_ms;
+    double orders_per_second;       // débit du matching seul
+    size_t peak_memory_kb;          // pic du processus depuis son lancement (fichiers précédents compris)
+    LatencyHistogram latencies[LATENCY_CATEGORY_COUNT];    // latence de matching par ordre (ns)
     
-    BenchmarkResult() : num_orders(0), execution_time_ms(0.0), 
-                       orders_per_second(0.0), avg_latency_us(0.0), peak_memory_kb(0) {}
+    BenchmarkResult() : num_orders(0), parse_time_ms(0.0), match_time_ms(0.0), write_time_ms(0.0),
+                       orders_per_second(0.0), peak_memory_kb(0) {}
 };
 
-// Fonction qui mesure la mémoire utilisée
+// Fonction qui mesure le pic de mémoire du processus depuis son lancement : le pic ne redescend jamais,
+// la valeur relevée après un fichier inclut donc celui des fichiers traités avant lui
 size_t measurePeakMemory() {
 #ifdef __linux__
     // Ouverture du fichier spécial Linux contenant les infos du processus actuel
     std::ifstream status_file("/proc/self/status");
     std::string line;
     
-    // Récupération de la RAM effectivement utilisée (ligne VmRSS)
+    // Récupération du pic de RAM effectivement utilisée (ligne VmHWM, "high water mark" de VmRSS)
     while (std::getline(status_file, line)) {
-        if (line.substr(0, 6) == "VmRSS:") {
+        if (line.substr(0, 6) == "VmHWM:") {
             // Extraire la valeur en kB
             size_t pos = line.find_first_of("0123456789");
             if (pos != std::string::npos) {
@@ -56,33 +75,50 @@ size_t measurePeakMemory() {
 #endif
 }
 
-// Fonction pour compter les ordres dans un fichier CSV
-size_t countOrders(const std::string& filepath) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        std::cerr << "Erreur: impossible d'ouvrir " << filepath << std::endl;
-        return 0;
-    }
-    
-    size_t count = 0;
-    std::string line;
-    
-    // Skip header
-    if (std::getline(file, line)) {
-        while (std::getline(file, line)) {
-            if (!line.empty()) {
-                count++;
-            }
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Affichage des percentiles de latence d'un fichier, catégorie par catégorie
+void displayLatencies(const BenchmarkResult& result) {
+    std::cout << std::left
+              << std::setw(15) << "Latence (ns)"
+              << std::setw(12) << "Nb Ordres"
+              << std::setw(10) << "p50"
+              << std::setw(10) << "p90"
+              << std::setw(10) << "p99"
+              << std::setw(10) << "p99.9"
+              << std::setw(10) << "max"
+              << std::endl;
+    for (int category = 0; category < LATENCY_CATEGORY_COUNT; category++) {
+        const LatencyHistogram& histogram = result.latencies[category];
+        if (histogram.count() == 0) {
+            continue;
         }
+        std::cout << std::left
+                  << std::setw(15) << LATENCY_CATEGORY_NAMES[category]
+                  << std::setw(12) << histogram.count()
+                  << std::setw(10) << histogram.percentile(50.0)
+                  << std::setw(10) << histogram.percentile(90.0)
+                  << std::setw(10) << histogram.percentile(99.0)
+                  << std::setw(10) << histogram.percentile(99.9)
+                  << std::setw(10) << histogram.max()
+                  << std::endl;
     }
-    return count;
 }
 
 // Fonction principale qui calcule toutes les métriques pour un fichier d'ordres
 BenchmarkResult benchmarkFile(const std::string& input_file) {
     BenchmarkResult result;
     result.filename = input_file;
-    result.num_orders = countOrders(input_file);
+
+    // 1. Lecture des ordres
+    auto start_time = std::chrono::steady_clock::now();
+    CsvReader reader(input_file);
+    reader.init();
+    std::map<std::string, OrderView> assets = reader.getMapOrder();
+    result.parse_time_ms = millisecondsSince(start_time);
+    result.num_orders = reader.getOrders().size();
     
     if (result.num_orders == 0) {
         std::cout << "Erreur: fichier vide ou inaccessible: " << input_file << std::endl;
@@ -91,41 +127,72 @@ BenchmarkResult benchmarkFile(const std::string& input_file) {
     
     std::cout << "Performances pour le fichier avec " << result.num_orders << " données : " << input_file << std::endl;
     
-    // 1. Mesure du temps d'exécution (on démarre le timer)
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
-    try {
-        // Lecture des ordres
-        CsvReader reader(input_file);
-        reader.init();
-        auto orders = reader.getOrders();
-        
-        // Traitement par le matching engine
-        MatchingEngine engine;
-        auto results = engine.processAllOrders(orders);
-        
-    } catch (const std::exception& e) {
-        std::cout << "Erreur lors du traitement: " << e.what() << std::endl;
-        return result;
+    // 2. Matching, ordre par ordre, un matching engine par actif.
+    // Les ordres sont traités dans l'ordre chronologique, avec le même tri que processAllOrders (le fichier
+    // n'est pas forcément trié) : les résultats sont ceux du traitement par lot.
+    // Chaque ordre est chronométré individuellement ; un ordre a croisé le carnet s'il a produit
+    // d'autres résultats que le sien (ceux des contreparties).
+    std::map<std::string, std::unique_ptr<MatchingEngine>> engines;
+    for (const auto& [asset_name, asset_orders] : assets) {
+        engines[asset_name] = std::make_unique<MatchingEngine>();
     }
-    // Fin du timer et calcul de la durée d'exécution (c'est en millisecondes)
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    start_time = std::chrono::steady_clock::now();
+    std::vector<uint32_t> positions;
+    for (const auto& [asset_name, asset_orders] : assets) {
+        MatchingEngine& engine = *engines[asset_name];
+        positions.resize(asset_orders.size());
+        for (size_t i = 0; i < asset_orders.size(); i++) {
+            positions[i] = static_cast<uint32_t>(i);
+        }
+        auto earlier = [&asset_orders](uint32_t a, uint32_t b) {
+            return asset_orders[a].timestamp < asset_orders[b].timestamp;
+        };
+        if (!std::is_sorted(positions.begin(), positions.end(), earlier)) {
+            std::sort(positions.begin(), positions.end(), earlier);
+        }
+        for (uint32_t position : positions) {
+            const Order& order = asset_orders[position];
+            size_t results_before = engine.getResults().size();
+            auto order_start = std::chrono::steady_clock::now();
+            engine.processOrder(order);
+            auto order_end = std::chrono::steady_clock::now();
+            uint64_t latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(order_end - order_start).count());
+
+            result.latencies[LATENCY_ALL].record(latency);
+            if (order.action == Action::NEW) {
+                result.latencies[LATENCY_NEW].record(latency);
+            } else if (order.action == Action::MODIFY) {
+                result.latencies[LATENCY_MODIFY].record(latency);
+            } else if (order.action == Action::CANCEL) {
+                result.latencies[LATENCY_CANCEL].record(latency);
+            }
+            bool crossed = engine.getResults().size() - results_before > 1;
+            result.latencies[crossed ? LATENCY_CROSSED : LATENCY_RESTING].record(latency);
+        }
+    }
+    result.match_time_ms = millisecondsSince(start_time);
+
+    // 3. Écriture des résultats
+    start_time = std::chrono::steady_clock::now();
+    for (const auto& [asset_name, engine] : engines) {
+        CsvWriter writer("build/tests/Performance/output_" + asset_name + ".csv");
+        writer.WriteToCsv(engine->getResults());
+    }
+    result.write_time_ms = millisecondsSince(start_time);
+    system("rm -f build/tests/Performance/output_*.csv");
     
-    // 2. Calcul des autres métriques
-    result.execution_time_ms = duration.count() / 1000.0;  // transformation en secondes du temps d'exec
-    result.orders_per_second = (result.num_orders * 1000.0) / result.execution_time_ms;  
-    result.avg_latency_us = static_cast<double>(duration.count()) / result.num_orders;
+    // 4. Calcul des autres métriques
+    result.orders_per_second = (result.num_orders * 1000.0) / result.match_time_ms;
     result.peak_memory_kb = measurePeakMemory();
     
     // Affichage des résultats
-    std::cout << "Temps d'exécution: " << std::fixed << std::setprecision(2) 
-              << result.execution_time_ms << " ms" << std::endl;
-    std::cout << "Débit: " << std::fixed << std::setprecision(0) 
+    std::cout << std::fixed << std::setprecision(2)
+              << "Lecture: " << result.parse_time_ms << " ms, matching: " << result.match_time_ms
+              << " ms, écriture: " << result.write_time_ms << " ms" << std::endl;
+    std::cout << "Débit du matching: " << std::setprecision(0) 
               << result.orders_per_second << " ordres/seconde" << std::endl;
-    std::cout << "Latence moyenne: " << std::fixed << std::setprecision(2) 
-              << result.avg_latency_us << " µs/ordre" << std::endl;
-    std::cout << "Mémoire utilisée: " << result.peak_memory_kb << " KB" << std::endl;
+    displayLatencies(result);
+    std::cout << "Pic de mémoire du processus (depuis le lancement): " << result.peak_memory_kb << " KB" << std::endl;
     std::cout << "Traitement terminé avec succès !!\n" << std::endl;
     
     return result;
@@ -141,28 +208,231 @@ void displaySummary(const std::vector<BenchmarkResult>& results) {
     
     std::cout << std::left 
               << std::setw(25) << "Fichier"
-              << std::setw(15) << "Nb Ordres"
-              << std::setw(15) << "Temps (s)"
-              << std::setw(15) << "Ordres/sec"
-              << std::setw(15) << "Latence (µs)"
-              << std::setw(15) << "Mémoire (KB)"
+              << std::setw(12) << "Nb Ordres"
+              << std::setw(12) << "Lecture(ms)"
+              << std::setw(13) << "Matching(ms)"
+              << std::setw(14) << "Écriture(ms)"
+              << std::setw(12) << "Ordres/sec"
+              << std::setw(10) << "p50(ns)"
+              << std::setw(10) << "p99(ns)"
+              << std::setw(11) << "p99.9(ns)"
+              << std::setw(10) << "max(ns)"
+              << std::setw(15) << "Pic proc.(KB)"
               << std::endl;
     
-    std::cout << std::string(110, '-') << std::endl;
+    std::cout << std::string(140, '-') << std::endl;
     
     for (const auto& result : results) {
         if (result.num_orders > 0) {
+            const LatencyHistogram& latencies = result.latencies[LATENCY_ALL];
             std::cout << std::left << std::fixed
                       << std::setw(25) << result.filename.substr(result.filename.find_last_of("/\\") + 1)
-                      << std::setw(15) << result.num_orders
-                      << std::setw(15) << std::setprecision(3) << (result.execution_time_ms / 1000.0)
-                      << std::setw(15) << std::setprecision(0) << result.orders_per_second
-                      << std::setw(15) << std::setprecision(2) << result.avg_latency_us
+                      << std::setw(12) << result.num_orders
+                      << std::setw(12) << std::setprecision(2) << result.parse_time_ms
+                      << std::setw(13) << result.match_time_ms
+                      << std::setw(14) << result.write_time_ms
+                      << std::setw(12) << std::setprecision(0) << result.orders_per_second
+                      << std::setw(10) << latencies.percentile(50.0)
+                      << std::setw(10) << latencies.percentile(99.0)
+                      << std::setw(11) << latencies.percentile(99.9)
+                      << std::setw(10) << latencies.max()
                       << std::setw(15) << result.peak_memory_kb
                       << std::endl;
         }
     }
-            std::cout << std::string(110, '-') << std::endl;
+    std::cout << std::string(140, '-') << std::endl;
+}
+
+// ###########################################################################################################
+// DÉBIT DE LECTURE SELON LA PROPORTION DE LIGNES INVALIDES
+// ###########################################################################################################
+
+// Génération d'un fichier de num_rows ordres dont une proportion malformed_ratio est invalide
+// (erreurs variées : timestamp, ID, side, quantité hors capacité, prix, action). Le fichier est déterministe.
+void generateParseInput(const std::string& path, size_t num_rows, double malformed_ratio) {
+    static const char* const BAD_FIELDS[][8] = {
+        {"abc", "1", "AAPL", "BUY", "LIMIT", "10", "150.25", "NEW"},
+        {"1617278400000000000", "-3", "AAPL", "BUY", "LIMIT", "10", "150.25", "NEW"},
+        {"1617278400000000000", "1", "AAPL", "ERROR", "LIMIT", "10", "150.25", "NEW"},
+        {"1617278400000000000", "1", "AAPL", "SELL", "LIMIT", "99999999999", "150.25", "NEW"},
+        {"1617278400000000000", "1", "AAPL", "SELL", "LIMIT", "10", "-150.25", "NEW"},
+        {"1617278400000000000", "1", "AAPL", "BUY", "LIMIT", "10", "150.25", "TEST"},
+    };
+    std::ofstream file(path);
+    file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    size_t bad_every = (malformed_ratio > 0.0) ? static_cast<size_t>(1.0 / malformed_ratio + 0.5) : 0;
+    for (size_t i = 0; i < num_rows; i++) {
+        if (bad_every > 0 && i % bad_every == 0) {
+            const char* const* fields = BAD_FIELDS[(i / bad_every) % 6];
+            for (int f = 0; f < 8; f++) {
+                file << fields[f] << (f < 7 ? "," : "\n");
+            }
+        } else {
+            file << 1617278400000000000LL + static_cast<long long>(i) * 100 << "," << i + 1 << ",AAPL,"
+                 << (i % 2 == 0 ? "BUY" : "SELL") << ",LIMIT," << 1 + i % 100 << ","
+                 << 140 + i % 20 << "." << i % 100 << ",NEW\n";
+        }
+    }
+}
+
+// Mesure du débit de lecture / validation du CsvReader (sans matching)
+void benchmarkParsing(size_t num_rows, double malformed_ratio) {
+    std::string path = "build/tests/Performance/parse_" + std::to_string(static_cast<int>(malformed_ratio * 100)) + "pct.csv";
+    generateParseInput(path, num_rows, malformed_ratio);
+    std::ifstream size_probe(path, std::ios::binary | std::ios::ate);
+    double size_mb = static_cast<double>(size_probe.tellg()) / (1024.0 * 1024.0);
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    CsvReader reader(path);
+    reader.init();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    size_t bad_rows = 0;
+    for (const Order& order : reader.getOrders()) {
+        if (order.type == OrderType::BAD_INPUT) {
+            bad_rows++;
+        }
+    }
+    std::cout << std::left << std::fixed
+              << std::setw(15) << (std::to_string(static_cast<int>(malformed_ratio * 100)) + "%")
+              << std::setw(15) << reader.getOrders().size()
+              << std::setw(15) << bad_rows
+              << std::setw(15) << std::setprecision(3) << seconds
+              << std::setw(15) << std::setprecision(0) << (reader.getOrders().size() / seconds)
+              << std::setw(15) << std::setprecision(1) << (size_mb / seconds)
+              << std::endl;
+    std::remove(path.c_str());
+}
+
+// ###########################################################################################################
+// CHARGEMENT D'UN FICHIER CONVERTI EN COLONNES CONTRE PARSING DU CSV
+// ###########################################################################################################
+
+// Temps de chargement du même fichier d'ordres, en CSV puis converti en colonnes
+void benchmarkColumns(const std::string& csv_file) {
+    std::string columns_file = "build/tests/Performance/replay.cols";
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    CsvReader csv_reader(csv_file);
+    csv_reader.init();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double csv_seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    OrderColumnsWriter writer(columns_file);
+    writer.WriteColumns(csv_reader.getOrders());
+
+    start_time = std::chrono::high_resolution_clock::now();
+    CsvReader columns_reader(columns_file);
+    columns_reader.init();
+    end_time = std::chrono::high_resolution_clock::now();
+    double columns_seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    std::ifstream csv_probe(csv_file, std::ios::binary | std::ios::ate);
+    std::ifstream columns_probe(columns_file, std::ios::binary | std::ios::ate);
+    std::cout << std::left << std::fixed
+              << std::setw(15) << "CSV" << std::setw(15) << csv_reader.getOrders().size()
+              << std::setw(15) << std::setprecision(3) << csv_seconds
+              << std::setw(15) << std::setprecision(1) << (static_cast<double>(csv_probe.tellg()) / (1024.0 * 1024.0))
+              << std::endl
+              << std::setw(15) << "Colonnes" << std::setw(15) << columns_reader.getOrders().size()
+              << std::setw(15) << std::setprecision(3) << columns_seconds
+              << std::setw(15) << std::setprecision(1) << (static_cast<double>(columns_probe.tellg()) / (1024.0 * 1024.0))
+              << std::endl;
+    std::remove(columns_file.c_str());
+}
+
+// ###########################################################################################################
+// DÉBIT DU MODE CONTINU SELON LE NOMBRE DE SHARDS
+// ###########################################################################################################
+
+// Génération d'un flux chronologique de num_rows ordres LIMIT répartis sur num_instruments actifs
+// (prix autour de 100 : une bonne partie des ordres se croisent). Le fichier est déterministe.
+void generateShardInput(const std::string& path, size_t num_rows, size_t num_instruments) {
+    std::ofstream file(path);
+    file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    uint64_t state = 42;
+    for (size_t i = 0; i < num_rows; i++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint32_t random = static_cast<uint32_t>(state >> 33);
+        file << 1617278400000000000LL + static_cast<long long>(i) * 100 << "," << i + 1
+             << ",SYM" << random % num_instruments << "," << ((random >> 8) % 2 == 0 ? "BUY" : "SELL")
+             << ",LIMIT," << 1 + (random >> 9) % 100 << "," << 95 + (random >> 16) % 10 << "."
+             << (random >> 20) % 100 << ",NEW\n";
+    }
+}
+
+// Débit de bout en bout du ShardedEngine : le thread principal route les ordres, un thread collecteur
+// récupère les résultats. Le temps mesuré va du premier ordre envoyé au dernier résultat récupéré.
+void benchmarkShards(const std::vector<Order>& orders, size_t shard_count) {
+    std::atomic<bool> done(false);
+    size_t result_count = 0;
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    ShardedEngine sharded(shard_count);
+    std::thread collector([&sharded, &done, &result_count]() {
+        std::vector<OrderResult> results;
+        results.reserve(4096);
+        while (!done.load(std::memory_order_acquire)) {
+            result_count += sharded.pollResults(results);
+            results.clear();
+        }
+    });
+    for (const Order& order : orders) {
+        sharded.submit(order);
+    }
+    sharded.stop();
+    done.store(true, std::memory_order_release);
+    collector.join();
+    std::vector<OrderResult> remaining;
+    result_count += sharded.pollResults(remaining);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    std::cout << std::left << std::fixed
+              << std::setw(15) << shard_count
+              << std::setw(15) << orders.size()
+              << std::setw(15) << result_count
+              << std::setw(15) << std::setprecision(3) << seconds
+              << std::setw(15) << std::setprecision(0) << (orders.size() / seconds)
+              << std::endl;
+}
+
+// ###########################################################################################################
+// PIPELINE (LECTURE -> VALIDATION -> MATCHING -> FORMATAGE -> ÉCRITURE) CONTRE TRAITEMENT PAR ÉTAPES SUCCESSIVES
+// ###########################################################################################################
+
+// Comparaison, sur un même fichier, du traitement par étapes successives (chargement complet, matching de
+// chaque actif, écriture) et du pipeline. Le pipeline donne aussi le temps de travail de chacun de ses étages.
+void benchmarkPipeline(const std::string& input_file) {
+    std::string prefix = "build/tests/Performance/";
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    {
+        CsvReader reader(input_file);
+        reader.init();
+        for (const auto& [asset_name, asset_orders] : reader.getMapOrder()) {
+            MatchingEngine engine;
+            engine.processAllOrders(asset_orders);
+            CsvWriter writer(prefix + "seq_" + asset_name + ".csv");
+            writer.WriteToCsv(engine.getResults());
+        }
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double sequential_seconds = std::chrono::duration<double>(end_time - start_time).count();
+
+    Pipeline pipeline(input_file, prefix + "pipe_");
+    const PipelineStats& stats = pipeline.run();
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "Étapes successives : " << sequential_seconds << " s" << std::endl
+              << "Pipeline           : " << stats.total_seconds << " s ("
+              << std::setprecision(0) << (stats.orders / stats.total_seconds) << " ordres/sec)" << std::endl
+              << std::setprecision(3)
+              << "  lecture " << stats.read_seconds << " s, validation " << stats.parse_seconds
+              << " s, matching " << stats.match_seconds
+              << " s, formatage " << stats.format_seconds << " s, écriture " << stats.write_seconds << " s" << std::endl;
+    system(("rm -f '" + prefix + "'seq_*.csv '" + prefix + "'pipe_*.csv").c_str());
 }
 
 // MAIN : on fait les tests de performance sur le nombre de fichiers que l'on souhaite. 
@@ -181,6 +451,60 @@ int main() {
     
     // Affichage du résumé comparatif
     displaySummary(results);
+
+    // Débit de lecture selon la proportion de lignes invalides
+    std::cout << "\nDÉBIT DE LECTURE DU CSV (1 000 000 de lignes)" << std::endl;
+    std::cout << std::left
+              << std::setw(15) << "Invalides"
+              << std::setw(15) << "Nb Ordres"
+              << std::setw(15) << "BAD_INPUT"
+              << std::setw(15) << "Temps (s)"
+              << std::setw(15) << "Lignes/sec"
+              << std::setw(15) << "Mo/sec"
+              << std::endl;
+    std::cout << std::string(90, '-') << std::endl;
+    benchmarkParsing(1000000, 0.0);
+    benchmarkParsing(1000000, 0.1);
+    benchmarkParsing(1000000, 0.5);
+
+    // Rejeu d'un fichier converti en colonnes
+    std::cout << "\nCHARGEMENT CSV / COLONNES (2 000 000 de lignes)" << std::endl;
+    std::cout << std::left
+              << std::setw(15) << "Format"
+              << std::setw(15) << "Nb Ordres"
+              << std::setw(15) << "Temps (s)"
+              << std::setw(15) << "Taille (Mo)"
+              << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    std::string replay_input = "build/tests/Performance/replay.csv";
+    generateParseInput(replay_input, 2000000, 0.0);
+    benchmarkColumns(replay_input);
+    std::remove(replay_input.c_str());
+
+    // Débit du mode continu selon le nombre de shards
+    std::cout << "\nDÉBIT DU MODE CONTINU PAR SHARDS (500 000 ordres, 64 actifs, " 
+              << std::thread::hardware_concurrency() << " coeurs)" << std::endl;
+    std::cout << std::left
+              << std::setw(15) << "Shards"
+              << std::setw(15) << "Nb Ordres"
+              << std::setw(15) << "Résultats"
+              << std::setw(15) << "Temps (s)"
+              << std::setw(15) << "Ordres/sec"
+              << std::endl;
+    std::cout << std::string(75, '-') << std::endl;
+    std::string shard_input = "build/tests/Performance/shards.csv";
+    generateShardInput(shard_input, 500000, 64);
+    CsvReader shard_reader(shard_input);
+    shard_reader.init();
+    for (size_t shard_count : {1, 2, 4, 8}) {
+        benchmarkShards(shard_reader.getOrders(), shard_count);
+    }
+
+    // Pipeline contre étapes successives, sur le même flux
+    std::cout << "\nPIPELINE (500 000 ordres, 64 actifs)" << std::endl;
+    std::cout << std::string(75, '-') << std::endl;
+    benchmarkPipeline(shard_input);
+    std::remove(shard_input.c_str());
     
     return 0;
 }
\ No newline at end of file
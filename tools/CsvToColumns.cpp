@@ -0,0 +1,29 @@
+// OUTIL DE CONVERSION D'UN CSV D'ORDRES EN FICHIER EN COLONNES (REJOUÉ SANS PARSING PAR LE CsvReader)
+// Utilisation : ./build/tools/csv_to_columns <ordres.csv> [sortie.cols]
+// (par défaut, le fichier est écrit à côté du CSV, avec l'extension .cols)
+#include <iostream>
+#include <string>
+#include "data/CSVReader.h"
+#include "data/OrderColumns.h"
+#include "utils/Logger.h"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Utilisation : " << argv[0] << " <ordres.csv> [sortie.cols]" << std::endl;
+        return 1;
+    }
+    std::string input_file = argv[1];
+    std::string output_file = (argc > 2) ? argv[2] : input_file.substr(0, input_file.find_last_of('.')) + ".cols";
+
+    CsvReader reader(input_file);
+    reader.init();
+    OrderColumnsWriter writer(output_file);
+    bool converted = writer.WriteColumns(reader.getOrders());
+    LOG_FLUSH();
+    if (!converted) {
+        std::cerr << "Echec de la conversion de " << input_file << std::endl;
+        return 1;
+    }
+    std::cout << reader.getOrders().size() << " ordres écrits dans " << output_file << std::endl;
+    return 0;
+}
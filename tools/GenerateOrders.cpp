@@ -0,0 +1,83 @@
+// OUTIL DE GÉNÉRATION DE FLUX D'ORDRES SYNTHÉTIQUES (REPRODUCTIBLES) POUR LES BENCHMARKS
+// Utilisation : ./build/tools/generate_orders --orders N --output fichier [options]
+//   --seed S           graine (défaut 42)                 --instruments K   nombre d'instruments (défaut 3)
+//   --zipf s           asymétrie entre instruments (1.0)  --modify r        part des MODIFY (0.1)
+//   --cancel r         part des CANCEL (0.05)             --market r        part des MARKET parmi les NEW (0.05)
+//   --aggressive r     part des LIMIT qui croisent (0.1)  --volatility v    écart-type du prix milieu, en ticks (1.0)
+//   --depth d          niveaux de prix des LIMIT passifs (20)
+//   --format csv|columns  CSV d'input (défaut) ou fichier en colonnes (rechargé sans parsing par le CsvReader ;
+//                         tous les ordres sont alors gardés en mémoire avant l'écriture)
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "data/CSVWriter.h"
+#include "data/OrderColumns.h"
+#include "data/OrderFlowGenerator.h"
+#include "utils/Logger.h"
+
+int main(int argc, char** argv) {
+    OrderFlowConfig config;
+    size_t order_count = 0;
+    std::string output_file;
+    std::string format = "csv";
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        const char* value = argv[i + 1];
+        if (option == "--orders") order_count = std::strtoull(value, nullptr, 10);
+        else if (option == "--output") output_file = value;
+        else if (option == "--format") format = value;
+        else if (option == "--seed") config.seed = std::strtoull(value, nullptr, 10);
+        else if (option == "--instruments") config.instrument_count = std::strtoull(value, nullptr, 10);
+        else if (option == "--zipf") config.zipf_skew = std::atof(value);
+        else if (option == "--modify") config.modify_ratio = std::atof(value);
+        else if (option == "--cancel") config.cancel_ratio = std::atof(value);
+        else if (option == "--market") config.market_share = std::atof(value);
+        else if (option == "--aggressive") config.aggressive_share = std::atof(value);
+        else if (option == "--volatility") config.volatility = std::atof(value);
+        else if (option == "--depth") config.book_depth = std::atoi(value);
+        else {
+            std::cerr << "Option inconnue : " << option << std::endl;
+            return 1;
+        }
+    }
+    if (order_count == 0 || output_file.empty() || (format != "csv" && format != "columns") || config.book_depth < 1) {
+        std::cerr << "Utilisation : " << argv[0] << " --orders N --output fichier [--format csv|columns] [options]" << std::endl;
+        return 1;
+    }
+
+    OrderFlowGenerator generator(config);
+    bool written;
+    if (format == "columns") {
+        std::vector<Order> orders;
+        orders.reserve(order_count);
+        for (size_t i = 0; i < order_count; i++) {
+            orders.push_back(generator.next());
+        }
+        OrderColumnsWriter writer(output_file);
+        written = writer.WriteColumns(orders);
+    } else {
+        // Écriture par blocs, sans garder les ordres en mémoire
+        std::ofstream file(output_file, std::ios::binary);
+        std::string buffer = "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+        buffer.reserve(WRITE_BUFFER_SIZE + 256);
+        for (size_t i = 0; i < order_count; i++) {
+            OrderFlowGenerator::appendCsvRow(generator.next(), buffer);
+            buffer += '\n';
+            if (buffer.size() >= WRITE_BUFFER_SIZE) {
+                file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        written = static_cast<bool>(file);
+    }
+    LOG_FLUSH();
+    if (!written) {
+        std::cerr << "Echec de l'écriture de " << output_file << std::endl;
+        return 1;
+    }
+    std::cout << order_count << " ordres écrits dans " << output_file << std::endl;
+    return 0;
+}
@@ -0,0 +1,26 @@
+// OUTIL DE CONVERSION D'UN JOURNAL BINAIRE DE RÉSULTATS AU FORMAT CSV DE SORTIE
+// Utilisation : ./build/tools/result_log_to_csv <journal.bin> [sortie.csv]
+// (par défaut, le CSV est écrit à côté du journal, avec l'extension .csv)
+#include <iostream>
+#include <string>
+#include "data/ResultLog.h"
+#include "utils/Logger.h"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Utilisation : " << argv[0] << " <journal.bin> [sortie.csv]" << std::endl;
+        return 1;
+    }
+    std::string input_file = argv[1];
+    std::string output_file = (argc > 2) ? argv[2] : input_file.substr(0, input_file.find_last_of('.')) + ".csv";
+
+    ResultLogReader reader(input_file);
+    bool converted = reader.writeCsv(output_file);
+    LOG_FLUSH();
+    if (!converted) {
+        std::cerr << "Echec de la conversion de " << input_file << std::endl;
+        return 1;
+    }
+    std::cout << reader.size() << " résultats écrits dans " << output_file << std::endl;
+    return 0;
+}